@@ -36,7 +36,11 @@
 
 #include "driver_tea5767_basic.h"
 
-static tea5767_handle_t gs_handle;        /**< tea5767 handle */
+static tea5767_handle_t gs_handle;              /**< tea5767 handle */
+static tea5767_telemetry_t gs_telemetry;        /**< tea5767 telemetry */
+static tea5767_task_t gs_seek_task;             /**< tea5767 seek task */
+static tea5767_task_t gs_search_task;           /**< tea5767 search task of the seek */
+static tea5767_task_t gs_afc_task;              /**< tea5767 afc task of the seek */
 
 /**
  * @brief  basic example init
@@ -56,6 +60,9 @@ uint8_t tea5767_basic_init(void)
     DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
     DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
     DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_READ_SUBMIT(&gs_handle, tea5767_interface_iic_read_submit);
+    DRIVER_TEA5767_LINK_IIC_WRITE_SUBMIT(&gs_handle, tea5767_interface_iic_write_submit);
     DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
     DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
     
@@ -302,97 +309,123 @@ uint8_t tea5767_basic_deinit(void)
 }
 
 /**
- * @brief  basic example search up
- * @return status code
- *         - 0 success
- *         - 1 search up failed
- *         - 2 reach band limit
- * @note   none
+ * @brief     basic example seek step function
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] ms current timestamp in ms
+ * @return    tea5767_task_status_t
+ * @note      none
  */
-uint8_t tea5767_basic_search_up(void)
+static uint8_t a_tea5767_basic_seek_step(tea5767_task_t *task, uint32_t ms)
 {
-    uint8_t res;
-    uint16_t pll;
-    tea5767_bool_t ready_flag;
-    tea5767_bool_t limit_flag;
+    TEA5767_TASK_BEGIN(task);
     
-    /* set search mode up */
-    res = tea5767_set_search_mode(&gs_handle, TEA5767_SEARCH_MODE_UP);
-    if (res != 0)
+    /* search */
+    if (tea5767_search_task(&gs_handle, &gs_search_task, (tea5767_search_mode_t)task->mode) != 0)
     {
-        return 1;
+        TEA5767_TASK_EXIT(task, 1);
+    }
+    TEA5767_TASK_AWAIT(task, &gs_search_task, ms);
+    if (gs_search_task.res == 4)
+    {
+        TEA5767_TASK_EXIT(task, 2);
+    }
+    if (gs_search_task.res != 0)
+    {
+        TEA5767_TASK_EXIT(task, 1);
     }
     
-    /* search mode */
-    res = tea5767_set_mode(&gs_handle, TEA5767_MODE_SEARCH);
-    if (res != 0)
+    /* save the searched pll */
+    if (tea5767_get_searched_pll(&gs_handle, &task->pll[0]) != 0)
     {
-        return 1;
+        TEA5767_TASK_EXIT(task, 1);
     }
     
-    /* write conf */
-    res = tea5767_write_conf(&gs_handle);
-    if (res != 0)
+    /* lock the if counter */
+    if (tea5767_afc_task(&gs_handle, &gs_afc_task) != 0)
     {
-        return 1;
+        TEA5767_TASK_EXIT(task, 1);
+    }
+    TEA5767_TASK_AWAIT(task, &gs_afc_task, ms);
+    if (gs_afc_task.res == 6)
+    {
+        /* the afc moved the pll without a lock, go back to the searched pll */
+        (void)tea5767_set_pll(&gs_handle, task->pll[0]);
+        (void)tea5767_write_conf(&gs_handle);
+    }
+    if (gs_afc_task.res != 0)
+    {
+        TEA5767_TASK_EXIT(task, 1);
     }
     
-    /* wait searched */
-    while (1)
+    TEA5767_TASK_END(task);
+}
+
+/**
+ * @brief      basic example prepare a seek task
+ * @param[in]  mode search mode
+ * @param[out] **task pointer to a task pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 prepare failed
+ * @note       add the task to a scheduler, the task result is 0 for a found station,
+ *             1 for a failed seek, no carrier or an unlocked if counter and 2 for the band limit
+ */
+uint8_t tea5767_basic_seek_task(tea5767_search_mode_t mode, tea5767_task_t **task)
+{
+    /* prepare the task */
+    if (tea5767_task_init(&gs_seek_task, a_tea5767_basic_seek_step, NULL) != 0)
     {
-        /* read conf */
-        res = tea5767_read_conf(&gs_handle);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* read ready flag */
-        res = tea5767_get_ready_flag(&gs_handle, &ready_flag);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* get band limit flag */
-        res = tea5767_get_band_limit_flag(&gs_handle, &limit_flag);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* check teh ready flag */
-        if (ready_flag == TEA5767_BOOL_TRUE)
-        {
-            break;
-        }
-        
-        /* delay 200ms */
-        tea5767_interface_delay_ms(200);
+        return 1;
     }
+    gs_seek_task.mode = (uint8_t)mode;
+    *task = &gs_seek_task;
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example seek
+ * @param[in] mode search mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 seek failed
+ *            - 2 reach band limit
+ * @note      none
+ */
+static uint8_t a_tea5767_basic_seek(tea5767_search_mode_t mode)
+{
+    tea5767_sched_t sched;
+    tea5767_task_t *task;
     
-    if (limit_flag == TEA5767_BOOL_TRUE)
+    /* prepare the seek */
+    if (tea5767_basic_seek_task(mode, &task) != 0)
     {
-        return 2;
+        return 1;
     }
-    else
+    
+    /* run the seek */
+    (void)tea5767_sched_init(&sched);
+    (void)tea5767_sched_add(&sched, task);
+    if (tea5767_sched_run(&sched, tea5767_interface_delay_ms) != 0)
     {
-        /* get the searched pll */
-        res = tea5767_get_searched_pll(&gs_handle, &pll);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* save the pll */
-        res = tea5767_set_pll(&gs_handle, pll);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        return 0;
+        return 1;
     }
+    
+    return task->res;
+}
+
+/**
+ * @brief  basic example search up
+ * @return status code
+ *         - 0 success
+ *         - 1 search up failed
+ *         - 2 reach band limit
+ * @note   the found station is fine tuned by the if counter, no carrier or an unlocked if counter fails
+ *         and an unlocked if counter goes back to the searched pll
+ */
+uint8_t tea5767_basic_search_up(void)
+{
+    return a_tea5767_basic_seek(TEA5767_SEARCH_MODE_UP);
 }
 
 /**
@@ -401,109 +434,120 @@ uint8_t tea5767_basic_search_up(void)
  *         - 0 success
  *         - 1 search down failed
  *         - 2 reach band limit
- * @note   none
+ * @note   the found station is fine tuned by the if counter, no carrier or an unlocked if counter fails
+ *         and an unlocked if counter goes back to the searched pll
  */
 uint8_t tea5767_basic_search_down(void)
+{
+    return a_tea5767_basic_seek(TEA5767_SEARCH_MODE_DOWN);
+}
+
+/**
+ * @brief      basic example scan the band
+ * @param[out] *station pointer to a station table
+ * @param[in]  len station table length
+ * @param[out] *num pointer to a found station number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ * @note       none
+ */
+uint8_t tea5767_basic_scan(tea5767_station_t *station, uint16_t len, uint16_t *num)
 {
     uint8_t res;
-    uint16_t pll;
-    tea5767_bool_t ready_flag;
-    tea5767_bool_t limit_flag;
     
-    /* set search mode down */
-    res = tea5767_set_search_mode(&gs_handle, TEA5767_SEARCH_MODE_DOWN);
+    /* scan by the chained search */
+    res = tea5767_scan(&gs_handle, TEA5767_SCAN_MODE_SEARCH, station, len, num);
     if (res != 0)
     {
         return 1;
     }
     
-    /* search mode */
-    res = tea5767_set_mode(&gs_handle, TEA5767_MODE_SEARCH);
+    return 0;
+}
+
+/**
+ * @brief     basic example set frequency
+ * @param[in] mhz set frequency
+ * @return    status code
+ *            - 0 success
+ *            - 1 set frequency failed
+ * @note      none
+ */
+uint8_t tea5767_basic_set_frequency(float mhz)
+{
+    uint8_t res;
+    uint16_t pll;
+    
+    /* convert to register */
+    res = tea5767_frequency_convert_to_register(&gs_handle, mhz, &pll);
     if (res != 0)
     {
         return 1;
     }
     
-    /* write conf */
-    res = tea5767_write_conf(&gs_handle);
+    /* set pll */
+    res = tea5767_set_pll(&gs_handle, pll);
     if (res != 0)
     {
         return 1;
     }
     
-    /* wait searched */
-    while (1)
+    /* flush conf */
+    res = tea5767_flush_conf(&gs_handle);
+    if (res != 0)
     {
-        /* read conf */
-        res = tea5767_read_conf(&gs_handle);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* read ready flag */
-        res = tea5767_get_ready_flag(&gs_handle, &ready_flag);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* get band limit flag */
-        res = tea5767_get_band_limit_flag(&gs_handle, &limit_flag);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* check teh ready flag */
-        if (ready_flag == TEA5767_BOOL_TRUE)
-        {
-            break;
-        }
-        
-        /* delay 200ms */
-        tea5767_interface_delay_ms(200);
+        return 1;
     }
     
-    if (limit_flag == TEA5767_BOOL_TRUE)
+    return 0;
+}
+
+/**
+ * @brief      basic example get frequency
+ * @param[out] *mhz pointer to a frequency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get frequency failed
+ * @note       none
+ */
+uint8_t tea5767_basic_get_frequency(float *mhz)
+{
+    uint8_t res;
+    uint16_t pll;
+    
+    /* read searched pll */
+    res = tea5767_read_searched_pll(&gs_handle, &pll);
+    if (res != 0)
     {
-        return 2;
+        return 1;
     }
-    else
+    
+    /* convert */
+    res = tea5767_frequency_convert_to_data(&gs_handle, pll, mhz);
+    if (res != 0)
     {
-        /* get the searched pll */
-        res = tea5767_get_searched_pll(&gs_handle, &pll);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        /* save the pll */
-        res = tea5767_set_pll(&gs_handle, pll);
-        if (res != 0)
-        {
-            return 1;
-        }
-        
-        return 0;
+        return 1;
     }
+    
+    return 0;
 }
 
 /**
- * @brief     basic example set frequency
- * @param[in] mhz set frequency
+ * @brief     basic example set frequency in KHz
+ * @param[in] khz set frequency
  * @return    status code
  *            - 0 success
  *            - 1 set frequency failed
- * @note      none
+ * @note      integer only
  */
-uint8_t tea5767_basic_set_frequency(float mhz)
+uint8_t tea5767_basic_set_frequency_khz(uint32_t khz)
 {
     uint8_t res;
     uint16_t pll;
     
     /* convert to register */
-    res = tea5767_frequency_convert_to_register(&gs_handle, mhz, &pll);
+    res = tea5767_khz_to_pll(&gs_handle, khz, &pll);
     if (res != 0)
     {
         return 1;
@@ -516,8 +560,8 @@ uint8_t tea5767_basic_set_frequency(float mhz)
         return 1;
     }
     
-    /* write conf */
-    res = tea5767_write_conf(&gs_handle);
+    /* flush conf */
+    res = tea5767_flush_conf(&gs_handle);
     if (res != 0)
     {
         return 1;
@@ -527,34 +571,149 @@ uint8_t tea5767_basic_set_frequency(float mhz)
 }
 
 /**
- * @brief      basic example get frequency
- * @param[out] *mhz pointer to a frequency buffer
+ * @brief      basic example get frequency in KHz
+ * @param[out] *khz pointer to a frequency buffer
  * @return     status code
  *             - 0 success
  *             - 1 get frequency failed
- * @note       none
+ * @note       integer only
  */
-uint8_t tea5767_basic_get_frequency(float *mhz)
+uint8_t tea5767_basic_get_frequency_khz(uint32_t *khz)
 {
     uint8_t res;
     uint16_t pll;
     
-    /* read conf */
-    res = tea5767_read_conf(&gs_handle);
+    /* read searched pll */
+    res = tea5767_read_searched_pll(&gs_handle, &pll);
     if (res != 0)
     {
         return 1;
     }
     
-    /* get searched pll */
-    res = tea5767_get_searched_pll(&gs_handle, &pll);
+    /* convert */
+    res = tea5767_pll_to_khz(&gs_handle, pll, khz);
     if (res != 0)
     {
         return 1;
     }
     
-    /* convert */
-    res = tea5767_frequency_convert_to_data(&gs_handle, pll, mhz);
+    return 0;
+}
+
+/**
+ * @brief      basic example get the signal meter
+ * @param[out] *level pointer to a level adc output buffer
+ * @param[out] *reception pointer to a reception buffer
+ * @param[out] *if_out pointer to an if out buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get meter failed
+ * @note       one 4 bytes read
+ */
+uint8_t tea5767_basic_get_meter(uint8_t *level, tea5767_reception_t *reception, uint8_t *if_out)
+{
+    uint8_t res;
+    
+    /* read up to the level */
+    res = tea5767_read_level_adc_output(&gs_handle, level);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* get reception */
+    res = tea5767_get_reception(&gs_handle, reception);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* get if */
+    res = tea5767_get_if(&gs_handle, if_out);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example start the telemetry
+ * @param[in] *ring pointer to a sample ring
+ * @param[in] period_ms sample period in ms, 0 stops sampling
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the ring is cleared only when it changes
+ */
+uint8_t tea5767_basic_telemetry_start(tea5767_telemetry_ring_t *ring, uint32_t period_ms, uint32_t ms)
+{
+    uint8_t res;
+    
+    /* telemetry init */
+    if ((gs_telemetry.inited != 1) || (gs_telemetry.ring != ring))
+    {
+        res = tea5767_telemetry_init(&gs_telemetry, &gs_handle, ring);
+        if (res != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* set the period */
+    res = tea5767_telemetry_set_period(&gs_telemetry, period_ms, ms);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example poll the telemetry
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 poll failed
+ * @note      none
+ */
+uint8_t tea5767_basic_telemetry_poll(uint32_t ms)
+{
+    /* poll */
+    if (tea5767_telemetry_poll(&gs_telemetry, ms) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example save the tuned station
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 1 save failed
+ * @note      the level is read before the record is saved
+ */
+uint8_t tea5767_basic_preset_save(tea5767_preset_store_t *store, uint8_t index)
+{
+    uint8_t res;
+    uint8_t level;
+    
+    /* read the level */
+    res = tea5767_read_level_adc_output(&gs_handle, &level);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* save */
+    res = tea5767_preset_save(&gs_handle, store, index);
     if (res != 0)
     {
         return 1;
@@ -563,6 +722,56 @@ uint8_t tea5767_basic_get_frequency(float *mhz)
     return 0;
 }
 
+/**
+ * @brief     basic example recall a station
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 1 recall failed
+ * @note      none
+ */
+uint8_t tea5767_basic_preset_recall(const tea5767_preset_store_t *store, uint8_t index)
+{
+    /* recall */
+    if (tea5767_preset_recall(&gs_handle, store, index) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example link the bus trace
+ * @param[in] *trace pointer to an initialized trace structure, NULL stops tracing
+ * @return    status code
+ *            - 0 success
+ * @note      the trace is unlinked by tea5767_basic_init
+ */
+uint8_t tea5767_basic_trace(tea5767_trace_t *trace)
+{
+    /* link the trace */
+    DRIVER_TEA5767_LINK_TRACE(&gs_handle, trace);
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example link the operation stats
+ * @param[in] *stats pointer to an initialized stats structure, NULL stops counting
+ * @return    status code
+ *            - 0 success
+ * @note      the stats are unlinked by tea5767_basic_init
+ */
+uint8_t tea5767_basic_stats(tea5767_stats_t *stats)
+{
+    /* link the stats */
+    DRIVER_TEA5767_LINK_STATS(&gs_handle, stats);
+    
+    return 0;
+}
+
 /**
  * @brief     basic example enable or disable mute
  * @param[in] enable bool value
@@ -603,8 +812,8 @@ uint8_t tea5767_basic_set_mute(tea5767_bool_t enable)
         return 1;
     }
     
-    /* write conf */
-    res = tea5767_write_conf(&gs_handle);
+    /* flush conf */
+    res = tea5767_flush_conf(&gs_handle);
     if (res != 0)
     {
         return 1;
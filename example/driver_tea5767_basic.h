@@ -38,6 +38,9 @@
 #define DRIVER_TEA5767_BASIC_H
 
 #include "driver_tea5767_interface.h"
+#include "driver_tea5767_telemetry.h"
+#include "driver_tea5767_preset.h"
+#include "driver_tea5767_sched.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -96,7 +99,8 @@ uint8_t tea5767_basic_deinit(void);
  *         - 0 success
  *         - 1 search up failed
  *         - 2 reach band limit
- * @note   none
+ * @note   the found station is fine tuned by the if counter, no carrier or an unlocked if counter fails
+ *         and an unlocked if counter goes back to the searched pll
  */
 uint8_t tea5767_basic_search_up(void);
 
@@ -106,10 +110,35 @@ uint8_t tea5767_basic_search_up(void);
  *         - 0 success
  *         - 1 search down failed
  *         - 2 reach band limit
- * @note   none
+ * @note   the found station is fine tuned by the if counter, no carrier or an unlocked if counter fails
+ *         and an unlocked if counter goes back to the searched pll
  */
 uint8_t tea5767_basic_search_down(void);
 
+/**
+ * @brief      basic example prepare a seek task
+ * @param[in]  mode search mode
+ * @param[out] **task pointer to a task pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 prepare failed
+ * @note       add the task to a scheduler, the task result is 0 for a found station,
+ *             1 for a failed seek, no carrier or an unlocked if counter and 2 for the band limit
+ */
+uint8_t tea5767_basic_seek_task(tea5767_search_mode_t mode, tea5767_task_t **task);
+
+/**
+ * @brief      basic example scan the band
+ * @param[out] *station pointer to a station table
+ * @param[in]  len station table length
+ * @param[out] *num pointer to a found station number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ * @note       none
+ */
+uint8_t tea5767_basic_scan(tea5767_station_t *station, uint16_t len, uint16_t *num);
+
 /**
  * @brief     basic example set frequency
  * @param[in] mhz set frequency
@@ -130,6 +159,100 @@ uint8_t tea5767_basic_set_frequency(float mhz);
  */
 uint8_t tea5767_basic_get_frequency(float *mhz);
 
+/**
+ * @brief     basic example set frequency in KHz
+ * @param[in] khz set frequency
+ * @return    status code
+ *            - 0 success
+ *            - 1 set frequency failed
+ * @note      integer only
+ */
+uint8_t tea5767_basic_set_frequency_khz(uint32_t khz);
+
+/**
+ * @brief      basic example get frequency in KHz
+ * @param[out] *khz pointer to a frequency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get frequency failed
+ * @note       integer only
+ */
+uint8_t tea5767_basic_get_frequency_khz(uint32_t *khz);
+
+/**
+ * @brief      basic example get the signal meter
+ * @param[out] *level pointer to a level adc output buffer
+ * @param[out] *reception pointer to a reception buffer
+ * @param[out] *if_out pointer to an if out buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get meter failed
+ * @note       one 4 bytes read
+ */
+uint8_t tea5767_basic_get_meter(uint8_t *level, tea5767_reception_t *reception, uint8_t *if_out);
+
+/**
+ * @brief     basic example start the telemetry
+ * @param[in] *ring pointer to a sample ring
+ * @param[in] period_ms sample period in ms, 0 stops sampling
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the ring is cleared only when it changes
+ */
+uint8_t tea5767_basic_telemetry_start(tea5767_telemetry_ring_t *ring, uint32_t period_ms, uint32_t ms);
+
+/**
+ * @brief     basic example poll the telemetry
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 poll failed
+ * @note      none
+ */
+uint8_t tea5767_basic_telemetry_poll(uint32_t ms);
+
+/**
+ * @brief     basic example save the tuned station
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 1 save failed
+ * @note      the level is read before the record is saved
+ */
+uint8_t tea5767_basic_preset_save(tea5767_preset_store_t *store, uint8_t index);
+
+/**
+ * @brief     basic example recall a station
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 1 recall failed
+ * @note      none
+ */
+uint8_t tea5767_basic_preset_recall(const tea5767_preset_store_t *store, uint8_t index);
+
+/**
+ * @brief     basic example link the bus trace
+ * @param[in] *trace pointer to an initialized trace structure, NULL stops tracing
+ * @return    status code
+ *            - 0 success
+ * @note      the trace is unlinked by tea5767_basic_init
+ */
+uint8_t tea5767_basic_trace(tea5767_trace_t *trace);
+
+/**
+ * @brief     basic example link the operation stats
+ * @param[in] *stats pointer to an initialized stats structure, NULL stops counting
+ * @return    status code
+ *            - 0 success
+ * @note      the stats are unlinked by tea5767_basic_init
+ */
+uint8_t tea5767_basic_stats(tea5767_stats_t *stats);
+
 /**
  * @brief     basic example enable or disable mute
  * @param[in] enable bool value
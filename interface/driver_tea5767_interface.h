@@ -92,6 +92,99 @@ uint8_t tea5767_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len
  */
 uint8_t tea5767_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      interface iic bus write read command
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the write and the read should go out as one bus transaction
+ */
+uint8_t tea5767_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief     interface iic bus write command on a bus context
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the port defines the ctx type, e.g. an iic mux channel,
+ *            used by a tuner pool where every tuner sits on its own bus context
+ */
+uint8_t tea5767_interface_iic_write_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the port defines the ctx type, e.g. an iic mux channel,
+ *             used by a tuner pool where every tuner sits on its own bus context
+ */
+uint8_t tea5767_interface_iic_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus write read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the port defines the ctx type, e.g. an iic mux channel,
+ *             used by a tuner pool where every tuner sits on its own bus context
+ */
+uint8_t tea5767_interface_iic_write_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                                 uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief     interface iic bus read submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the read finishes,
+ *            done is not called when the submit fails
+ */
+uint8_t tea5767_interface_iic_read_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                          tea5767_async_done_t done, void *arg);
+
+/**
+ * @brief     interface iic bus write submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the write finishes,
+ *            done is not called when the submit fails
+ */
+uint8_t tea5767_interface_iic_write_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                           tea5767_async_done_t done, void *arg);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
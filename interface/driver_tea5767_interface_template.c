@@ -90,6 +90,114 @@ uint8_t tea5767_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
     return 0;
 }
 
+/**
+ * @brief      interface iic bus write read command
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
+ */
+uint8_t tea5767_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write command on a bus context
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t tea5767_interface_iic_write_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t tea5767_interface_iic_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus write read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
+ */
+uint8_t tea5767_interface_iic_write_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                                 uint8_t *rbuf, uint16_t rlen)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus read submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the read finishes,
+ *            done is not called when the submit fails
+ */
+uint8_t tea5767_interface_iic_read_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                          tea5767_async_done_t done, void *arg)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the write finishes,
+ *            done is not called when the submit fails
+ */
+uint8_t tea5767_interface_iic_write_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                           tea5767_async_done_t done, void *arg)
+{
+    return 0;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -36,6 +36,7 @@
 
 #include "driver_tea5767_interface.h"
 #include "iic.h"
+#include "iic_async.h"
 #include <stdarg.h>
 
 /**
@@ -47,6 +48,7 @@
  * @brief iic device handle definition
  */
 static int gs_fd;                       /**< iic handle */
+static iic_async_t gs_async;            /**< iic worker of the submit commands */
 
 /**
  * @brief  interface iic bus init
@@ -57,7 +59,20 @@ static int gs_fd;                       /**< iic handle */
  */
 uint8_t tea5767_interface_iic_init(void)
 {
-    return iic_init(IIC_DEVICE_NAME, &gs_fd);
+    if (iic_init(IIC_DEVICE_NAME, &gs_fd) != 0)
+    {
+        return 1;
+    }
+    
+    /* start the worker of the submit commands */
+    if (iic_async_init(&gs_async, gs_fd) != 0)
+    {
+        (void)iic_deinit(gs_fd);
+        
+        return 1;
+    }
+    
+    return 0;
 }
 
 /**
@@ -69,6 +84,9 @@ uint8_t tea5767_interface_iic_init(void)
  */
 uint8_t tea5767_interface_iic_deinit(void)
 {
+    /* finish the submitted transfers before closing the bus */
+    (void)iic_async_deinit(&gs_async);
+    
     return iic_deinit(gs_fd);
 }
 
@@ -102,6 +120,120 @@ uint8_t tea5767_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
     return iic_read_cmd(gs_fd, addr, buf, len);
 }
 
+/**
+ * @brief      interface iic bus write read command
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the write and the read go out in one I2C_RDWR ioctl
+ */
+uint8_t tea5767_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    return iic_write_read_cmd(gs_fd, addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     interface iic bus write command on a bus context
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      ctx is an iic_mux_channel_t on a bus opened by iic_init
+ */
+uint8_t tea5767_interface_iic_write_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_mux_write_cmd(ctx, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       ctx is an iic_mux_channel_t on a bus opened by iic_init
+ */
+uint8_t tea5767_interface_iic_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_mux_read_cmd(ctx, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus write read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       ctx is an iic_mux_channel_t on a bus opened by iic_init
+ */
+uint8_t tea5767_interface_iic_write_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                                 uint8_t *rbuf, uint16_t rlen)
+{
+    return iic_mux_write_read_cmd(ctx, addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     interface iic bus read submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the read finishes,
+ *            done is not called when the submit fails,
+ *            the read runs on the iic worker thread
+ */
+uint8_t tea5767_interface_iic_read_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                          tea5767_async_done_t done, void *arg)
+{
+    (void)ctx;
+    
+    return iic_async_read_submit(&gs_async, addr, buf, len, done, arg);
+}
+
+/**
+ * @brief     interface iic bus write submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the write finishes,
+ *            done is not called when the submit fails,
+ *            the write runs on the iic worker thread
+ */
+uint8_t tea5767_interface_iic_write_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                           tea5767_async_done_t done, void *arg)
+{
+    (void)ctx;
+    
+    return iic_async_write_submit(&gs_async, addr, buf, len, done, arg);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      benchmark.h
+ * @brief     benchmark header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup benchmark benchmark function
+ * @brief    benchmark function modules
+ * @{
+ */
+
+/**
+ * @brief     benchmark the frequency conversion
+ * @param[in] times repeat times of the whole band
+ * @return    status code
+ *            - 0 success
+ *            - 1 benchmark failed
+ * @note      compares the float and the integer conversion on every KHz of 76MHz - 108MHz
+ */
+uint8_t benchmark_convert(uint32_t times);
+
+/**
+ * @brief     run the accessor workload
+ * @param[in] HANDLE pointer to an initialized tea5767 handle structure
+ * @param[in] TIMES loop times
+ * @param[in] SUM uint32_t sum of every read value
+ * @note      10 accessor calls per loop, expanded by every profile under test
+ */
+#define BENCHMARK_ACCESSOR_LOOP(HANDLE, TIMES, SUM)                                                   \
+    do {                                                                                              \
+        uint32_t i_;                                                                                  \
+        uint16_t pll_ = 0;                                                                            \
+        uint8_t if_ = 0;                                                                              \
+        uint8_t adc_ = 0;                                                                             \
+        tea5767_bool_t enable_ = TEA5767_BOOL_FALSE;                                                  \
+        tea5767_search_stop_level_t level_ = TEA5767_SEARCH_STOP_LEVEL_LOW;                           \
+        tea5767_clock_t clk_ = TEA5767_CLOCK_13_MHZ;                                                  \
+                                                                                                      \
+        for (i_ = 0; i_ < (TIMES); i_++)                                                              \
+        {                                                                                             \
+            (void)tea5767_set_pll((HANDLE), (uint16_t)(i_ & 0x3FFF));                                 \
+            (void)tea5767_set_mute((HANDLE), (tea5767_bool_t)(i_ & 0x01));                            \
+            (void)tea5767_set_search_stop_level((HANDLE), (tea5767_search_stop_level_t)((i_ >> 1) & 0x03)); \
+            (void)tea5767_set_clock((HANDLE), (tea5767_clock_t)(i_ % 3));                             \
+            (void)tea5767_get_pll((HANDLE), &pll_);                                                   \
+            (void)tea5767_get_mute((HANDLE), &enable_);                                               \
+            (void)tea5767_get_search_stop_level((HANDLE), &level_);                                   \
+            (void)tea5767_get_clock((HANDLE), &clk_);                                                 \
+            (void)tea5767_get_if((HANDLE), &if_);                                                     \
+            (void)tea5767_get_level_adc_output((HANDLE), &adc_);                                      \
+            (SUM) += (uint32_t)pll_ + (uint32_t)enable_ + (uint32_t)level_ +                          \
+                     (uint32_t)clk_ + (uint32_t)if_ + (uint32_t)adc_;                                 \
+        }                                                                                             \
+    } while (0)
+
+/**
+ * @brief     run the accessor workload with the fast accessors
+ * @param[in] *handle pointer to an initialized tea5767 handle structure
+ * @param[in] times loop times
+ * @return    sum of every read value
+ * @note      built with TEA5767_FAST_ACCESSORS and NDEBUG whatever the library profile is
+ */
+uint32_t benchmark_accessor_fast(tea5767_handle_t *handle, uint32_t times);
+
+/**
+ * @brief     benchmark the local conf accessors
+ * @param[in] times loop times
+ * @return    status code
+ *            - 0 success
+ *            - 1 benchmark failed
+ * @note      compares the linked accessors against the static inline accessors
+ */
+uint8_t benchmark_accessor(uint32_t times);
+
+#ifdef TEA5767_SIMULATOR
+/**
+ * @brief     benchmark the tuner pool
+ * @param[in] num tuner number
+ * @return    status code
+ *            - 0 success
+ *            - 1 benchmark failed
+ * @note      scans one simulated tuner after another and then all of them in parallel on one shared bus
+ */
+uint8_t benchmark_pool(uint8_t num);
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
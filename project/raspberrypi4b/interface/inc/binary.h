@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      binary.h
+ * @brief     binary header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef BINARY_H
+#define BINARY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup binary binary function
+ * @brief    binary command function modules
+ * @{
+ */
+
+/**
+ * @brief binary frame definition
+ * @note  a request is magic, opcode, device, reserved and a little endian 32 bits param,
+ *        a response is magic, opcode, device, status and a little endian 32 bits value
+ */
+#define BINARY_FRAME_LEN          8           /**< request and response length */
+#define BINARY_MAGIC              0xA5        /**< first byte of a frame, never the first byte of a text command */
+#define BINARY_DEVICE_NUM         1           /**< device number */
+
+/**
+ * @brief binary opcode enumeration definition
+ */
+typedef enum
+{
+    BINARY_OP_INIT        = 0x01,        /**< init the device */
+    BINARY_OP_DEINIT      = 0x02,        /**< deinit the device */
+    BINARY_OP_SET_FREQ    = 0x10,        /**< tune to param KHz */
+    BINARY_OP_GET_FREQ    = 0x11,        /**< value is the frequency in KHz */
+    BINARY_OP_SEARCH_UP   = 0x12,        /**< search up, value is the frequency in KHz */
+    BINARY_OP_SEARCH_DOWN = 0x13,        /**< search down, value is the frequency in KHz */
+    BINARY_OP_MUTE        = 0x20,        /**< param 1 mutes and 0 unmutes */
+    BINARY_OP_METER       = 0x30,        /**< value is level, reception << 8 and if << 16 */
+} binary_opcode_t;
+
+/**
+ * @brief binary status enumeration definition
+ */
+typedef enum
+{
+    BINARY_STATUS_OK             = 0x00,        /**< success */
+    BINARY_STATUS_FAILED         = 0x01,        /**< driver call failed */
+    BINARY_STATUS_BAND_LIMIT     = 0x02,        /**< search reached the band limit */
+    BINARY_STATUS_INVALID_OPCODE = 0x80,        /**< opcode is invalid */
+    BINARY_STATUS_INVALID_DEVICE = 0x81,        /**< device is invalid */
+    BINARY_STATUS_INVALID_PARAM  = 0x82,        /**< param is invalid */
+} binary_status_t;
+
+/**
+ * @brief      run one binary command
+ * @param[in]  *in pointer to a request frame
+ * @param[out] *out pointer to a response frame
+ * @return     response status
+ * @note       both frames are BINARY_FRAME_LEN bytes
+ */
+uint8_t binary_run(const uint8_t *in, uint8_t *out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -53,6 +53,39 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief iic batch max message definition
+ */
+#ifndef IIC_BATCH_MAX_MSG
+#define IIC_BATCH_MAX_MSG        16        /**< max messages of one batch */
+#endif
+
+/**
+ * @brief iic batch structure definition
+ * @note  the messages are sent in one I2C_RDWR ioctl with a repeated start between them
+ */
+typedef struct iic_batch_s
+{
+    uint8_t addr[IIC_BATCH_MAX_MSG];         /**< iic device write address */
+    uint8_t read[IIC_BATCH_MAX_MSG];         /**< read message flag */
+    uint8_t *buf[IIC_BATCH_MAX_MSG];         /**< data buffer */
+    uint16_t len[IIC_BATCH_MAX_MSG];         /**< data buffer length */
+    uint8_t num;                             /**< message number */
+} iic_batch_t;
+
+/**
+ * @brief iic mux channel structure definition
+ * @note  devices with the same address sit on different channels of one mux,
+ *        the channels of one mux share the selected mask so a channel is only selected when it changes
+ */
+typedef struct iic_mux_channel_s
+{
+    int fd;                  /**< iic handle of the shared bus */
+    uint8_t mux_addr;        /**< mux write address, 0 means no mux */
+    uint8_t channel;         /**< mux channel */
+    uint8_t *selected;       /**< pointer to the selected channel mask of the mux */
+} iic_mux_channel_t;
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -156,6 +189,106 @@ uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
  */
 uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      iic bus write read command
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_write_read_cmd(int fd, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief     clear the iic batch
+ * @param[in] *batch pointer to an iic batch structure
+ * @note      none
+ */
+void iic_batch_clear(iic_batch_t *batch);
+
+/**
+ * @brief     queue a write message
+ * @param[in] *batch pointer to an iic batch structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 batch is full
+ * @note      addr = device_address_7bits << 1, the buffer must stay valid until the batch is transferred
+ */
+uint8_t iic_batch_write(iic_batch_t *batch, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     queue a read message
+ * @param[in] *batch pointer to an iic batch structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 batch is full
+ * @note      addr = device_address_7bits << 1, the buffer must stay valid until the batch is transferred
+ */
+uint8_t iic_batch_read(iic_batch_t *batch, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     transfer the iic batch
+ * @param[in] fd iic handle
+ * @param[in] *batch pointer to an iic batch structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      all messages go out in one I2C_RDWR ioctl and the batch is cleared
+ */
+uint8_t iic_batch_transfer(int fd, iic_batch_t *batch);
+
+/**
+ * @brief      iic bus read command behind a mux channel
+ * @param[in]  *ctx pointer to an iic mux channel structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_mux_read_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     iic bus write command behind a mux channel
+ * @param[in] *ctx pointer to an iic mux channel structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1
+ */
+uint8_t iic_mux_write_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      iic bus write read command behind a mux channel
+ * @param[in]  *ctx pointer to an iic mux channel structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_mux_write_read_cmd(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
 /**
  * @}
  */
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_async.h
+ * @brief     iic async header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef IIC_ASYNC_H
+#define IIC_ASYNC_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup iic_async iic async function
+ * @brief    iic worker thread function modules
+ * @{
+ */
+
+/**
+ * @brief iic async definition
+ */
+#ifndef IIC_ASYNC_QUEUE_SIZE
+#define IIC_ASYNC_QUEUE_SIZE        8        /**< queued transfers of one worker */
+#endif
+
+/**
+ * @brief iic async done function definition
+ */
+typedef void (*iic_async_done_t)(void *arg, uint8_t res);
+
+/**
+ * @brief iic async request structure definition
+ */
+typedef struct iic_async_request_s
+{
+    uint8_t read;                 /**< read transfer flag */
+    uint8_t addr;                 /**< iic device write address */
+    uint8_t *buf;                 /**< data buffer */
+    uint16_t len;                 /**< data buffer length */
+    iic_async_done_t done;        /**< done function */
+    void *arg;                    /**< done argument */
+} iic_async_request_t;
+
+/**
+ * @brief iic async structure definition
+ * @note  one worker thread runs the queued transfers in order with the blocking iic commands,
+ *        the done functions are called on the worker thread
+ */
+typedef struct iic_async_s
+{
+    int fd;                                                    /**< iic handle */
+    pthread_t thread;                                          /**< worker thread */
+    pthread_mutex_t mutex;                                     /**< queue lock */
+    pthread_cond_t cond;                                       /**< signalled on submit and stop */
+    pthread_cond_t idle;                                       /**< signalled when a transfer finishes */
+    iic_async_request_t queue[IIC_ASYNC_QUEUE_SIZE];           /**< request queue */
+    uint8_t head;                                              /**< oldest request */
+    uint8_t num;                                               /**< queued requests */
+    uint8_t busy;                                              /**< transfer running flag */
+    uint8_t run;                                               /**< worker running flag */
+} iic_async_t;
+
+/**
+ * @brief     start an iic worker
+ * @param[in] *async pointer to an iic async structure
+ * @param[in] fd iic handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      none
+ */
+uint8_t iic_async_init(iic_async_t *async, int fd);
+
+/**
+ * @brief     stop an iic worker
+ * @param[in] *async pointer to an iic async structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      the queued transfers are finished before the worker stops
+ */
+uint8_t iic_async_deinit(iic_async_t *async);
+
+/**
+ * @brief     submit an iic read
+ * @param[in] *ctx pointer to an iic async structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue is full or worker is stopped
+ * @note      the buffer must stay valid until done is called
+ */
+uint8_t iic_async_read_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                              iic_async_done_t done, void *arg);
+
+/**
+ * @brief     submit an iic write
+ * @param[in] *ctx pointer to an iic async structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue is full or worker is stopped
+ * @note      the buffer must stay valid until done is called
+ */
+uint8_t iic_async_write_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                               iic_async_done_t done, void *arg);
+
+/**
+ * @brief     wait until all submitted transfers are finished
+ * @param[in] *async pointer to an iic async structure
+ * @note      the writes of the done functions are visible to the caller afterwards
+ */
+void iic_async_wait(iic_async_t *async);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ring.h
+ * @brief     ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RING_H
+#define RING_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ring ring function
+ * @brief    shared memory ring function modules
+ * @{
+ */
+
+/**
+ * @brief ring definition
+ */
+#define RING_SLOT_NUM         64         /**< slots of one ring, must be a power of 2 */
+#define RING_COMMAND_LEN      254        /**< max length of one command */
+#define RING_CACHE_LINE       64         /**< cache line size */
+
+/**
+ * @brief ring command slot structure definition
+ */
+typedef struct ring_slot_s
+{
+    uint16_t len;                          /**< command length */
+    char buf[RING_COMMAND_LEN];            /**< command */
+} ring_slot_t;
+
+/**
+ * @brief ring channel structure definition
+ * @note  the channel lives in shared memory, the client produces commands and consumes status,
+ *        the server consumes commands and produces status, every index has its own cache line
+ */
+typedef struct ring_channel_s
+{
+    _Atomic uint32_t command_head __attribute__((aligned(RING_CACHE_LINE)));        /**< written by the client */
+    _Atomic uint32_t command_tail __attribute__((aligned(RING_CACHE_LINE)));        /**< written by the server */
+    _Atomic uint32_t status_head __attribute__((aligned(RING_CACHE_LINE)));         /**< written by the server */
+    _Atomic uint32_t status_tail __attribute__((aligned(RING_CACHE_LINE)));         /**< written by the client */
+    _Atomic uint32_t doorbell __attribute__((aligned(RING_CACHE_LINE)));            /**< set while the server sleeps */
+    ring_slot_t command[RING_SLOT_NUM] __attribute__((aligned(RING_CACHE_LINE)));   /**< command slots */
+    uint8_t status[RING_SLOT_NUM];                                                  /**< status slots */
+} ring_channel_t;
+
+/**
+ * @brief ring structure definition
+ */
+typedef struct ring_s
+{
+    ring_channel_t *channel;        /**< mapped channel */
+    int mem_fd;                     /**< shared memory handle */
+    int event_fd;                   /**< doorbell handle */
+} ring_t;
+
+/**
+ * @brief      create a ring
+ * @param[out] *ring pointer to a ring structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 create failed
+ * @note       used by the client, the handles are sent to the server afterwards
+ */
+uint8_t ring_create(ring_t *ring);
+
+/**
+ * @brief      attach to a ring created by the peer
+ * @param[out] *ring pointer to a ring structure
+ * @param[in]  mem_fd shared memory handle
+ * @param[in]  event_fd doorbell handle
+ * @return     status code
+ *             - 0 success
+ *             - 1 attach failed
+ * @note       used by the server, the ring owns the handles afterwards
+ */
+uint8_t ring_attach(ring_t *ring, int mem_fd, int event_fd);
+
+/**
+ * @brief     close a ring
+ * @param[in] *ring pointer to a ring structure
+ * @note      none
+ */
+void ring_close(ring_t *ring);
+
+/**
+ * @brief     push a command
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *buf pointer to a command buffer
+ * @param[in] len command length
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ *            - 2 command is too long
+ * @note      the doorbell is only rung when the server sleeps
+ */
+uint8_t ring_push_command(ring_t *ring, const char *buf, uint16_t len);
+
+/**
+ * @brief      pop a command
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *buf pointer to a command buffer
+ * @param[out] *len pointer to a command length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ * @note       the buffer must hold RING_COMMAND_LEN bytes
+ */
+uint8_t ring_pop_command(ring_t *ring, char *buf, uint16_t *len);
+
+/**
+ * @brief     push a status
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] status status code
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ * @note      none
+ */
+uint8_t ring_push_status(ring_t *ring, uint8_t status);
+
+/**
+ * @brief      pop a status
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ * @note       none
+ */
+uint8_t ring_pop_status(ring_t *ring, uint8_t *status);
+
+/**
+ * @brief     arm the doorbell before the server sleeps
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 server can sleep
+ *            - 1 commands are pending
+ * @note      none
+ */
+uint8_t ring_sleep(ring_t *ring);
+
+/**
+ * @brief     disarm the doorbell after the server wakes up
+ * @param[in] *ring pointer to a ring structure
+ * @note      none
+ */
+void ring_wake(ring_t *ring);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -58,6 +58,7 @@ extern "C"{
 #define SHELL_MAX_NAME        32         /**< shell max function name length */
 #define SHELL_MAX_REG_SIZE    32         /**< shell max register number */
 #define SHELL_MAX_BUF_SIZE    256        /**< shell max buffer size */
+#define SHELL_HASH_SIZE       64         /**< shell hash table size, a power of 2 above twice SHELL_MAX_REG_SIZE */
 
 /**
  * @brief function struture definition
@@ -65,6 +66,7 @@ extern "C"{
 typedef struct function_s
 {
     char name[SHELL_MAX_NAME];                        /**< functon name */
+    uint32_t hash;                                    /**< functon name hash */
     uint8_t (*fuc)(uint8_t argc, char **argv);        /**< function address */
 } function_t;
 
@@ -75,6 +77,7 @@ typedef struct shell_s
 {
     function_t fuc[SHELL_MAX_REG_SIZE];         /**< functon buffer */
     uint16_t fuc_i;                             /**< functon number */
+    uint8_t table[SHELL_HASH_SIZE];             /**< hash table of functon index + 1, 0 means empty */
     char *argv[SHELL_MAX_SIZE];                 /**< argv temp buffer */
     char buf_out[SHELL_MAX_BUF_SIZE];           /**< output buffer */
 } shell_t;
@@ -94,7 +97,7 @@ uint8_t shell_init(void);
  * @return    status code
  *            - 0 success
  *            - 1 buffer is full
- * @note      none
+ * @note      the name is hashed once here, the first registered function wins a duplicated name
  */
 uint8_t shell_register(char *name, uint8_t (*fuc)(uint8_t argc, char **argv));
 
@@ -108,7 +111,7 @@ uint8_t shell_register(char *name, uint8_t (*fuc)(uint8_t argc, char **argv));
  *            - 2 find function failed
  *            - 3 length is too big
  *            - 4 pretreat failed
- * @note      none
+ * @note      the command name is hashed while it is split, so the function is found in constant time
  */
 uint8_t shell_parse(char *buf, uint16_t len);
 
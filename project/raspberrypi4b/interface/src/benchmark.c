@@ -0,0 +1,493 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      benchmark.c
+ * @brief     benchmark source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "benchmark.h"
+#include "driver_tea5767_interface.h"
+#ifdef TEA5767_SIMULATOR
+#include "driver_tea5767_pool.h"
+#include "driver_tea5767_simulator.h"
+#endif
+#include <time.h>
+
+/**
+ * @brief benchmark band definition
+ */
+#define BENCHMARK_MIN_KHZ        76000         /**< min frequency */
+#define BENCHMARK_MAX_KHZ        108000        /**< max frequency */
+
+static tea5767_handle_t gs_handle;             /**< tea5767 handle */
+static volatile uint32_t gs_sink;              /**< keep the results alive */
+#ifdef TEA5767_SIMULATOR
+#define BENCHMARK_POOL_MAX        4             /**< max simulated tuner number */
+#define BENCHMARK_POOL_LEN        32            /**< station table length of one tuner */
+static tea5767_pool_t gs_pool;                                                       /**< tuner pool */
+static tea5767_simulator_t gs_pool_sim[BENCHMARK_POOL_MAX];                          /**< simulated tuners */
+static tea5767_station_t gs_pool_station[BENCHMARK_POOL_MAX * BENCHMARK_POOL_LEN];   /**< station tables */
+#endif
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     benchmark the frequency conversion
+ * @param[in] times repeat times of the whole band
+ * @return    status code
+ *            - 0 success
+ *            - 1 benchmark failed
+ * @note      compares the float and the integer conversion on every KHz of 76MHz - 108MHz
+ */
+uint8_t benchmark_convert(uint32_t times)
+{
+    const char *clk_name[3] = {"13MHz", "32.768KHz", "6.5MHz"};
+    const char *side_name[2] = {"low", "high"};
+    uint8_t res;
+    uint8_t clk;
+    uint8_t side;
+    uint16_t pll;
+    uint16_t pll_check;
+    uint32_t i;
+    uint32_t khz;
+    uint32_t khz_check;
+    uint32_t n;
+    uint32_t rounding;
+    uint32_t mismatch;
+    uint32_t round_trip;
+    uint64_t t0;
+    uint64_t t_float;
+    uint64_t t_int;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    
+    /* init the handle */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* at least once */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    n = (BENCHMARK_MAX_KHZ - BENCHMARK_MIN_KHZ + 1) * times;
+    res = 0;
+    for (clk = 0; clk < 3; clk++)
+    {
+        for (side = 0; side < 2; side++)
+        {
+            /* set the local conf, no bus access */
+            (void)tea5767_set_clock(&gs_handle, (tea5767_clock_t)clk);
+            (void)tea5767_set_side_injection(&gs_handle, (tea5767_side_injection_t)side);
+            
+            /* float path */
+            t0 = a_benchmark_ns();
+            for (i = 0; i < times; i++)
+            {
+                for (khz = BENCHMARK_MIN_KHZ; khz <= BENCHMARK_MAX_KHZ; khz++)
+                {
+                    (void)tea5767_frequency_convert_to_register(&gs_handle, (float)khz / 1000.0f, &pll);
+                    gs_sink += pll;
+                }
+            }
+            t_float = a_benchmark_ns() - t0;
+            
+            /* integer path */
+            t0 = a_benchmark_ns();
+            for (i = 0; i < times; i++)
+            {
+                for (khz = BENCHMARK_MIN_KHZ; khz <= BENCHMARK_MAX_KHZ; khz++)
+                {
+                    (void)tea5767_khz_to_pll(&gs_handle, khz, &pll);
+                    gs_sink += pll;
+                }
+            }
+            t_int = a_benchmark_ns() - t0;
+            
+            /* check the results */
+            rounding = 0;
+            mismatch = 0;
+            round_trip = 0;
+            for (khz = BENCHMARK_MIN_KHZ; khz <= BENCHMARK_MAX_KHZ; khz++)
+            {
+                (void)tea5767_frequency_convert_to_register(&gs_handle, (float)khz / 1000.0f, &pll_check);
+                (void)tea5767_khz_to_pll(&gs_handle, khz, &pll);
+                if (pll != pll_check)
+                {
+                    uint32_t lo;
+                    uint32_t num;
+                    uint32_t den;
+                    
+                    /* float may land one below an exact integer quotient */
+                    lo = (side != 0) ? (khz + 225) : (khz - 225);
+                    num = (clk == 1) ? 125 : 1;
+                    den = (clk == 0) ? 3250 : ((clk == 1) ? 1024 : 1625);
+                    if (((lo * num) % den == 0) && (pll_check + 1 == pll))
+                    {
+                        rounding++;
+                    }
+                    else
+                    {
+                        mismatch++;
+                    }
+                }
+                if ((tea5767_pll_to_khz(&gs_handle, pll, &khz_check) != 0) ||
+                    (tea5767_khz_to_pll(&gs_handle, khz_check, &pll_check) != 0) ||
+                    (pll_check != pll) || (khz_check > khz))
+                {
+                    round_trip++;
+                }
+            }
+            
+            /* output */
+            tea5767_interface_debug_print("tea5767: %s %s side float %0.2fns int %0.2fns per conversion.\n",
+                                          clk_name[clk], side_name[side],
+                                          (double)t_float / (double)n, (double)t_int / (double)n);
+            tea5767_interface_debug_print("tea5767: %d float rounding, %d mismatch, %d round trip errors.\n",
+                                          rounding, mismatch, round_trip);
+            if ((mismatch != 0) || (round_trip != 0))
+            {
+                res = 1;
+            }
+        }
+    }
+    (void)tea5767_deinit(&gs_handle);
+    
+    return res;
+}
+
+/**
+ * @brief     run the accessor workload with the linked accessors
+ * @param[in] *handle pointer to an initialized tea5767 handle structure
+ * @param[in] times loop times
+ * @return    sum of every read value
+ * @note      the accessors are the out of line checked ones unless the library is built with TEA5767_FAST_ACCESSORS
+ */
+static uint32_t a_benchmark_accessor_linked(tea5767_handle_t *handle, uint32_t times)
+{
+    uint32_t sum;
+    
+    sum = 0;
+    BENCHMARK_ACCESSOR_LOOP(handle, times, sum);
+    
+    return sum;
+}
+
+/**
+ * @brief     benchmark the local conf accessors
+ * @param[in] times loop times
+ * @return    status code
+ *            - 0 success
+ *            - 1 benchmark failed
+ * @note      compares the linked accessors against the static inline accessors
+ */
+uint8_t benchmark_accessor(uint32_t times)
+{
+    uint8_t res;
+    uint8_t conf[5];
+    uint32_t sum_linked;
+    uint32_t sum_fast;
+    uint64_t t0;
+    uint64_t t_linked;
+    uint64_t t_fast;
+    double n;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    
+    /* init the handle */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* at least once */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    n = (double)times * 10.0;
+    
+    /* both runs start from the same conf */
+    memcpy(conf, gs_handle.conf_up, 5);
+    
+    /* linked path */
+    t0 = a_benchmark_ns();
+    sum_linked = a_benchmark_accessor_linked(&gs_handle, times);
+    t_linked = a_benchmark_ns() - t0;
+    
+    /* fast path */
+    memcpy(gs_handle.conf_up, conf, 5);
+    t0 = a_benchmark_ns();
+    sum_fast = benchmark_accessor_fast(&gs_handle, times);
+    t_fast = a_benchmark_ns() - t0;
+    gs_sink += sum_linked + sum_fast;
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: library profile %s.\n",
+                                  (TEA5767_FAST_ACCESSORS != 0) ? "fast accessors" : "checked accessors");
+    tea5767_interface_debug_print("tea5767: linked %0.2fns fast %0.2fns per call, %0.2fns saved.\n",
+                                  (double)t_linked / n, (double)t_fast / n,
+                                  ((double)t_linked - (double)t_fast) / n);
+    if (sum_linked != sum_fast)
+    {
+        tea5767_interface_debug_print("tea5767: accessor results mismatch.\n");
+        res = 1;
+    }
+    (void)tea5767_deinit(&gs_handle);
+    
+    return res;
+}
+
+#ifdef TEA5767_SIMULATOR
+/**
+ * @brief     advance every simulated tuner on the shared bus
+ * @param[in] *sim pointer to the tuner which already advanced
+ * @param[in] us elapsed time in us
+ * @note      all tuners sit on one bus and share one clock
+ */
+static void a_benchmark_pool_advance(tea5767_simulator_t *sim, uint32_t us)
+{
+    uint8_t i;
+    
+    for (i = 0; i < BENCHMARK_POOL_MAX; i++)
+    {
+        if (&gs_pool_sim[i] != sim)
+        {
+            tea5767_simulator_advance_us(&gs_pool_sim[i], us);
+        }
+    }
+}
+
+/**
+ * @brief      pool iic read command
+ * @param[in]  *ctx pointer to a simulated tuner
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_benchmark_pool_read(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    uint64_t t0;
+    
+    t0 = tea5767_simulator_get_time_us((tea5767_simulator_t *)ctx);
+    res = tea5767_simulator_read((tea5767_simulator_t *)ctx, addr, buf, len);
+    a_benchmark_pool_advance((tea5767_simulator_t *)ctx,
+                             (uint32_t)(tea5767_simulator_get_time_us((tea5767_simulator_t *)ctx) - t0));
+    
+    return res;
+}
+
+/**
+ * @brief     pool iic write command
+ * @param[in] *ctx pointer to a simulated tuner
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_benchmark_pool_write(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    uint64_t t0;
+    
+    t0 = tea5767_simulator_get_time_us((tea5767_simulator_t *)ctx);
+    res = tea5767_simulator_write((tea5767_simulator_t *)ctx, addr, buf, len);
+    a_benchmark_pool_advance((tea5767_simulator_t *)ctx,
+                             (uint32_t)(tea5767_simulator_get_time_us((tea5767_simulator_t *)ctx) - t0));
+    
+    return res;
+}
+
+/**
+ * @brief     pool delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_benchmark_pool_delay_ms(uint32_t ms)
+{
+    a_benchmark_pool_advance(NULL, ms * 1000);
+}
+
+/**
+ * @brief     benchmark the tuner pool
+ * @param[in] num tuner number
+ * @return    status code
+ *            - 0 success
+ *            - 1 benchmark failed
+ * @note      scans one simulated tuner after another and then all of them in parallel on one shared bus
+ */
+uint8_t benchmark_pool(uint8_t num)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t index;
+    uint16_t serial_num[BENCHMARK_POOL_MAX];
+    uint16_t parallel_num[BENCHMARK_POOL_MAX];
+    uint64_t t0;
+    uint64_t t_serial;
+    uint64_t t_parallel;
+    tea5767_handle_t *handle;
+    
+    if ((num == 0) || (num > BENCHMARK_POOL_MAX))
+    {
+        tea5767_interface_debug_print("tea5767: tuner number is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* link functions */
+    DRIVER_TEA5767_POOL_LINK_INIT(&gs_pool, tea5767_pool_t);
+    DRIVER_TEA5767_POOL_LINK_IIC_READ_CTX_COMMAND(&gs_pool, a_benchmark_pool_read);
+    DRIVER_TEA5767_POOL_LINK_IIC_WRITE_CTX_COMMAND(&gs_pool, a_benchmark_pool_write);
+    DRIVER_TEA5767_POOL_LINK_DELAY_MS(&gs_pool, a_benchmark_pool_delay_ms);
+    DRIVER_TEA5767_POOL_LINK_DEBUG_PRINT(&gs_pool, tea5767_interface_debug_print);
+    
+    /* init the pool */
+    res = tea5767_pool_init(&gs_pool);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: pool init failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        (void)tea5767_simulator_init(&gs_pool_sim[i]);
+        res = tea5767_pool_add(&gs_pool, &gs_pool_sim[i], &index);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: pool add failed.\n");
+            (void)tea5767_pool_deinit(&gs_pool);
+            
+            return 1;
+        }
+        
+        /* set the local conf, written by the scan */
+        (void)tea5767_pool_get_handle(&gs_pool, index, &handle);
+        (void)tea5767_set_band(handle, TEA5767_BAND_JAPANESE);
+        (void)tea5767_set_clock(handle, TEA5767_CLOCK_32P768_KHZ);
+        (void)tea5767_set_side_injection(handle, TEA5767_SIDE_INJECTION_HIGH);
+        (void)tea5767_set_search_stop_level(handle, TEA5767_SEARCH_STOP_LEVEL_MID);
+    }
+    
+    /* one tuner after another */
+    t0 = tea5767_simulator_get_time_us(&gs_pool_sim[0]);
+    for (i = 0; i < num; i++)
+    {
+        (void)tea5767_pool_get_handle(&gs_pool, i, &handle);
+        res = tea5767_scan(handle, TEA5767_SCAN_MODE_SEARCH, &gs_pool_station[i * BENCHMARK_POOL_LEN],
+                           BENCHMARK_POOL_LEN, &serial_num[i]);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: scan failed.\n");
+            (void)tea5767_pool_deinit(&gs_pool);
+            
+            return 1;
+        }
+    }
+    t_serial = tea5767_simulator_get_time_us(&gs_pool_sim[0]) - t0;
+    
+    /* all tuners in parallel */
+    t0 = tea5767_simulator_get_time_us(&gs_pool_sim[0]);
+    res = tea5767_pool_scan(&gs_pool, TEA5767_SCAN_MODE_SEARCH, gs_pool_station, BENCHMARK_POOL_LEN, parallel_num);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: pool scan failed.\n");
+        (void)tea5767_pool_deinit(&gs_pool);
+        
+        return 1;
+    }
+    t_parallel = tea5767_simulator_get_time_us(&gs_pool_sim[0]) - t0;
+    
+    /* check the results */
+    for (i = 0; i < num; i++)
+    {
+        tea5767_interface_debug_print("tea5767: tuner %d found %d stations serial, %d stations parallel.\n",
+                                      i, serial_num[i], parallel_num[i]);
+        if ((serial_num[i] == 0) || (serial_num[i] != parallel_num[i]))
+        {
+            res = 1;
+        }
+    }
+    tea5767_interface_debug_print("tea5767: %d tuners serial scan %0.1fms, parallel scan %0.1fms, %0.2fx.\n",
+                                  num, (double)t_serial / 1000.0, (double)t_parallel / 1000.0,
+                                  (double)t_serial / (double)t_parallel);
+    if (tea5767_pool_deinit(&gs_pool) != 0)
+    {
+        res = 1;
+    }
+    
+    return res;
+}
+#endif
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      benchmark_fast.c
+ * @brief     benchmark fast accessors source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+/* this unit always uses the release fast profile */
+#undef TEA5767_FAST_ACCESSORS
+#define TEA5767_FAST_ACCESSORS 1
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+
+#include "benchmark.h"
+
+/**
+ * @brief     run the accessor workload with the fast accessors
+ * @param[in] *handle pointer to an initialized tea5767 handle structure
+ * @param[in] times loop times
+ * @return    sum of every read value
+ * @note      built with TEA5767_FAST_ACCESSORS and NDEBUG whatever the library profile is
+ */
+uint32_t benchmark_accessor_fast(tea5767_handle_t *handle, uint32_t times)
+{
+    uint32_t sum;
+    
+    sum = 0;
+    BENCHMARK_ACCESSOR_LOOP(handle, times, sum);
+    
+    return sum;
+}
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      binary.c
+ * @brief     binary source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "binary.h"
+#include "driver_tea5767_basic.h"
+
+/**
+ * @brief      dispatch one command to the driver
+ * @param[in]  opcode command opcode
+ * @param[in]  param command param
+ * @param[out] *value pointer to a value buffer
+ * @return     response status
+ * @note       none
+ */
+static uint8_t a_binary_dispatch(uint8_t opcode, uint32_t param, uint32_t *value)
+{
+    uint8_t res;
+    uint8_t level;
+    uint8_t if_out;
+    tea5767_reception_t reception;
+    
+    *value = 0;
+    switch (opcode)
+    {
+        case BINARY_OP_INIT :
+        {
+            return (tea5767_basic_init() == 0) ? BINARY_STATUS_OK : BINARY_STATUS_FAILED;
+        }
+        case BINARY_OP_DEINIT :
+        {
+            return (tea5767_basic_deinit() == 0) ? BINARY_STATUS_OK : BINARY_STATUS_FAILED;
+        }
+        case BINARY_OP_SET_FREQ :
+        {
+            return (tea5767_basic_set_frequency_khz(param) == 0) ? BINARY_STATUS_OK : BINARY_STATUS_FAILED;
+        }
+        case BINARY_OP_GET_FREQ :
+        {
+            return (tea5767_basic_get_frequency_khz(value) == 0) ? BINARY_STATUS_OK : BINARY_STATUS_FAILED;
+        }
+        case BINARY_OP_SEARCH_UP :
+        case BINARY_OP_SEARCH_DOWN :
+        {
+            res = (opcode == BINARY_OP_SEARCH_UP) ? tea5767_basic_search_up() : tea5767_basic_search_down();
+            if (res == 1)
+            {
+                return BINARY_STATUS_FAILED;
+            }
+            if (tea5767_basic_get_frequency_khz(value) != 0)
+            {
+                return BINARY_STATUS_FAILED;
+            }
+            
+            return (res == 2) ? BINARY_STATUS_BAND_LIMIT : BINARY_STATUS_OK;
+        }
+        case BINARY_OP_MUTE :
+        {
+            if (param > 1)
+            {
+                return BINARY_STATUS_INVALID_PARAM;
+            }
+            
+            return (tea5767_basic_set_mute((tea5767_bool_t)param) == 0) ? BINARY_STATUS_OK : BINARY_STATUS_FAILED;
+        }
+        case BINARY_OP_METER :
+        {
+            if (tea5767_basic_get_meter(&level, &reception, &if_out) != 0)
+            {
+                return BINARY_STATUS_FAILED;
+            }
+            *value = (uint32_t)level | ((uint32_t)reception << 8) | ((uint32_t)if_out << 16);
+            
+            return BINARY_STATUS_OK;
+        }
+        default :
+        {
+            return BINARY_STATUS_INVALID_OPCODE;
+        }
+    }
+}
+
+/**
+ * @brief      run one binary command
+ * @param[in]  *in pointer to a request frame
+ * @param[out] *out pointer to a response frame
+ * @return     response status
+ * @note       both frames are BINARY_FRAME_LEN bytes
+ */
+uint8_t binary_run(const uint8_t *in, uint8_t *out)
+{
+    uint8_t status;
+    uint32_t param;
+    uint32_t value;
+    
+    /* decode the param */
+    param = (uint32_t)in[4] | ((uint32_t)in[5] << 8) | ((uint32_t)in[6] << 16) | ((uint32_t)in[7] << 24);
+    
+    /* run the command */
+    value = 0;
+    if (in[2] >= BINARY_DEVICE_NUM)
+    {
+        status = BINARY_STATUS_INVALID_DEVICE;
+    }
+    else
+    {
+        status = a_binary_dispatch(in[1], param, &value);
+    }
+    
+    /* encode the response */
+    out[0] = BINARY_MAGIC;
+    out[1] = in[1];
+    out[2] = in[2];
+    out[3] = status;
+    out[4] = (uint8_t)(value >> 0);
+    out[5] = (uint8_t)(value >> 8);
+    out[6] = (uint8_t)(value >> 16);
+    out[7] = (uint8_t)(value >> 24);
+    
+    return status;
+}
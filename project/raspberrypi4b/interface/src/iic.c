@@ -363,3 +363,285 @@ uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, ui
      
     return 0;
 }
+
+/**
+ * @brief      iic bus write read command
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_write_read_cmd(int fd, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    iic_batch_t batch;
+    
+    /* queue the messages */
+    iic_batch_clear(&batch);
+    (void)iic_batch_write(&batch, addr, wbuf, wlen);
+    (void)iic_batch_read(&batch, addr, rbuf, rlen);
+    
+    return iic_batch_transfer(fd, &batch);
+}
+
+/**
+ * @brief     clear the iic batch
+ * @param[in] *batch pointer to an iic batch structure
+ * @note      none
+ */
+void iic_batch_clear(iic_batch_t *batch)
+{
+    batch->num = 0;
+}
+
+/**
+ * @brief     queue a message
+ * @param[in] *batch pointer to an iic batch structure
+ * @param[in] addr iic device write address
+ * @param[in] read read message flag
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 batch is full
+ * @note      none
+ */
+static uint8_t a_iic_batch_add(iic_batch_t *batch, uint8_t addr, uint8_t read, uint8_t *buf, uint16_t len)
+{
+    /* check the number */
+    if (batch->num >= IIC_BATCH_MAX_MSG)
+    {
+        return 1;
+    }
+    
+    /* save the message */
+    batch->addr[batch->num] = addr;
+    batch->read[batch->num] = read;
+    batch->buf[batch->num] = buf;
+    batch->len[batch->num] = len;
+    batch->num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     queue a write message
+ * @param[in] *batch pointer to an iic batch structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 batch is full
+ * @note      addr = device_address_7bits << 1, the buffer must stay valid until the batch is transferred
+ */
+uint8_t iic_batch_write(iic_batch_t *batch, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return a_iic_batch_add(batch, addr, 0, buf, len);
+}
+
+/**
+ * @brief     queue a read message
+ * @param[in] *batch pointer to an iic batch structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 batch is full
+ * @note      addr = device_address_7bits << 1, the buffer must stay valid until the batch is transferred
+ */
+uint8_t iic_batch_read(iic_batch_t *batch, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return a_iic_batch_add(batch, addr, 1, buf, len);
+}
+
+/**
+ * @brief     transfer the iic batch
+ * @param[in] fd iic handle
+ * @param[in] *batch pointer to an iic batch structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      all messages go out in one I2C_RDWR ioctl and the batch is cleared
+ */
+uint8_t iic_batch_transfer(int fd, iic_batch_t *batch)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[IIC_BATCH_MAX_MSG];
+    uint8_t i;
+    uint8_t num;
+    
+    /* nothing to send */
+    num = batch->num;
+    batch->num = 0;
+    if (num == 0)
+    {
+        return 0;
+    }
+    
+    /* clear ioctl data */
+    memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+    
+    /* clear msgs data */
+    memset(msgs, 0, sizeof(struct i2c_msg) * num);
+    
+    /* set the param */
+    for (i = 0; i < num; i++)
+    {
+        msgs[i].addr = batch->addr[i] >> 1;
+        msgs[i].flags = (batch->read[i] != 0) ? I2C_M_RD : 0;
+        msgs[i].buf = batch->buf[i];
+        msgs[i].len = batch->len[i];
+    }
+    i2c_rdwr_data.msgs = msgs;
+    i2c_rdwr_data.nmsgs = num;
+    
+    /* transmit */
+    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    {
+        perror("iic: batch transfer failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     queue the mux channel select
+ * @param[in] *mux pointer to an iic mux channel structure
+ * @param[in] *batch pointer to an iic batch structure
+ * @param[in] *mask pointer to a channel mask buffer
+ * @note      nothing is queued when there is no mux or the channel is already selected
+ */
+static void a_iic_mux_select(iic_mux_channel_t *mux, iic_batch_t *batch, uint8_t *mask)
+{
+    /* no mux */
+    if (mux->mux_addr == 0)
+    {
+        return;
+    }
+    
+    /* already selected */
+    *mask = (uint8_t)(1 << mux->channel);
+    if ((mux->selected != NULL) && (*mux->selected == *mask))
+    {
+        return;
+    }
+    
+    /* write the channel mask */
+    (void)iic_batch_write(batch, mux->mux_addr, mask, 1);
+}
+
+/**
+ * @brief     transfer the batch behind a mux channel
+ * @param[in] *mux pointer to an iic mux channel structure
+ * @param[in] *batch pointer to an iic batch structure
+ * @param[in] mask channel mask
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      the selected mask is cleared on failure because the mux state is unknown
+ */
+static uint8_t a_iic_mux_transfer(iic_mux_channel_t *mux, iic_batch_t *batch, uint8_t mask)
+{
+    if (iic_batch_transfer(mux->fd, batch) != 0)
+    {
+        if (mux->selected != NULL)
+        {
+            *mux->selected = 0;
+        }
+        
+        return 1;
+    }
+    if ((mux->mux_addr != 0) && (mux->selected != NULL))
+    {
+        *mux->selected = mask;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      iic bus read command behind a mux channel
+ * @param[in]  *ctx pointer to an iic mux channel structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_mux_read_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    iic_mux_channel_t *mux = (iic_mux_channel_t *)ctx;
+    iic_batch_t batch;
+    uint8_t mask = 0;
+    
+    /* select the channel and read in one transfer */
+    iic_batch_clear(&batch);
+    a_iic_mux_select(mux, &batch, &mask);
+    (void)iic_batch_read(&batch, addr, buf, len);
+    
+    return a_iic_mux_transfer(mux, &batch, mask);
+}
+
+/**
+ * @brief     iic bus write command behind a mux channel
+ * @param[in] *ctx pointer to an iic mux channel structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1
+ */
+uint8_t iic_mux_write_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    iic_mux_channel_t *mux = (iic_mux_channel_t *)ctx;
+    iic_batch_t batch;
+    uint8_t mask = 0;
+    
+    /* select the channel and write in one transfer */
+    iic_batch_clear(&batch);
+    a_iic_mux_select(mux, &batch, &mask);
+    (void)iic_batch_write(&batch, addr, buf, len);
+    
+    return a_iic_mux_transfer(mux, &batch, mask);
+}
+
+/**
+ * @brief      iic bus write read command behind a mux channel
+ * @param[in]  *ctx pointer to an iic mux channel structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_mux_write_read_cmd(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    iic_mux_channel_t *mux = (iic_mux_channel_t *)ctx;
+    iic_batch_t batch;
+    uint8_t mask = 0;
+    
+    /* select the channel, write and read in one transfer */
+    iic_batch_clear(&batch);
+    a_iic_mux_select(mux, &batch, &mask);
+    (void)iic_batch_write(&batch, addr, wbuf, wlen);
+    (void)iic_batch_read(&batch, addr, rbuf, rlen);
+    
+    return a_iic_mux_transfer(mux, &batch, mask);
+}
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_async.c
+ * @brief     iic async source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "iic_async.h"
+#include "iic.h"
+
+/**
+ * @brief     iic worker thread
+ * @param[in] *arg pointer to an iic async structure
+ * @return    NULL
+ * @note      none
+ */
+static void *a_iic_async_worker(void *arg)
+{
+    iic_async_t *async = (iic_async_t *)arg;
+    iic_async_request_t req;
+    uint8_t res;
+    
+    pthread_mutex_lock(&async->mutex);
+    while (1)
+    {
+        /* wait for a request, a stopped worker drains the queue first */
+        while ((async->num == 0) && (async->run != 0))
+        {
+            pthread_cond_wait(&async->cond, &async->mutex);
+        }
+        if (async->num == 0)
+        {
+            break;
+        }
+        
+        /* pop the oldest request */
+        req = async->queue[async->head];
+        async->head = (uint8_t)((async->head + 1) % IIC_ASYNC_QUEUE_SIZE);
+        async->num--;
+        async->busy = 1;
+        pthread_mutex_unlock(&async->mutex);
+        
+        /* run the transfer without the lock, so done can submit the next one */
+        if (req.read != 0)
+        {
+            res = iic_read_cmd(async->fd, req.addr, req.buf, req.len);
+        }
+        else
+        {
+            res = iic_write_cmd(async->fd, req.addr, req.buf, req.len);
+        }
+        req.done(req.arg, res);
+        
+        pthread_mutex_lock(&async->mutex);
+        async->busy = 0;
+        pthread_cond_broadcast(&async->idle);
+    }
+    pthread_mutex_unlock(&async->mutex);
+    
+    return NULL;
+}
+
+/**
+ * @brief     queue an iic request
+ * @param[in] *async pointer to an iic async structure
+ * @param[in] *req pointer to an iic async request structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue is full or worker is stopped
+ * @note      none
+ */
+static uint8_t a_iic_async_push(iic_async_t *async, iic_async_request_t *req)
+{
+    pthread_mutex_lock(&async->mutex);
+    if ((async->run == 0) || (async->num >= IIC_ASYNC_QUEUE_SIZE))
+    {
+        pthread_mutex_unlock(&async->mutex);
+        
+        return 1;
+    }
+    async->queue[(async->head + async->num) % IIC_ASYNC_QUEUE_SIZE] = *req;
+    async->num++;
+    pthread_cond_signal(&async->cond);
+    pthread_mutex_unlock(&async->mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief     start an iic worker
+ * @param[in] *async pointer to an iic async structure
+ * @param[in] fd iic handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      none
+ */
+uint8_t iic_async_init(iic_async_t *async, int fd)
+{
+    async->fd = fd;
+    async->head = 0;
+    async->num = 0;
+    async->busy = 0;
+    async->run = 1;
+    pthread_mutex_init(&async->mutex, NULL);
+    pthread_cond_init(&async->cond, NULL);
+    pthread_cond_init(&async->idle, NULL);
+    
+    /* start the worker */
+    if (pthread_create(&async->thread, NULL, a_iic_async_worker, async) != 0)
+    {
+        perror("iic: create worker failed.\n");
+        pthread_cond_destroy(&async->idle);
+        pthread_cond_destroy(&async->cond);
+        pthread_mutex_destroy(&async->mutex);
+        async->run = 0;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stop an iic worker
+ * @param[in] *async pointer to an iic async structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      the queued transfers are finished before the worker stops
+ */
+uint8_t iic_async_deinit(iic_async_t *async)
+{
+    /* stop the worker */
+    pthread_mutex_lock(&async->mutex);
+    if (async->run == 0)
+    {
+        pthread_mutex_unlock(&async->mutex);
+        
+        return 1;
+    }
+    async->run = 0;
+    pthread_cond_signal(&async->cond);
+    pthread_mutex_unlock(&async->mutex);
+    
+    /* join the worker */
+    if (pthread_join(async->thread, NULL) != 0)
+    {
+        perror("iic: join worker failed.\n");
+        
+        return 1;
+    }
+    pthread_cond_destroy(&async->idle);
+    pthread_cond_destroy(&async->cond);
+    pthread_mutex_destroy(&async->mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief     submit an iic read
+ * @param[in] *ctx pointer to an iic async structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue is full or worker is stopped
+ * @note      the buffer must stay valid until done is called
+ */
+uint8_t iic_async_read_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                              iic_async_done_t done, void *arg)
+{
+    iic_async_request_t req;
+    
+    req.read = 1;
+    req.addr = addr;
+    req.buf = buf;
+    req.len = len;
+    req.done = done;
+    req.arg = arg;
+    
+    return a_iic_async_push((iic_async_t *)ctx, &req);
+}
+
+/**
+ * @brief     submit an iic write
+ * @param[in] *ctx pointer to an iic async structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue is full or worker is stopped
+ * @note      the buffer must stay valid until done is called
+ */
+uint8_t iic_async_write_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                               iic_async_done_t done, void *arg)
+{
+    iic_async_request_t req;
+    
+    req.read = 0;
+    req.addr = addr;
+    req.buf = buf;
+    req.len = len;
+    req.done = done;
+    req.arg = arg;
+    
+    return a_iic_async_push((iic_async_t *)ctx, &req);
+}
+
+/**
+ * @brief     wait until all submitted transfers are finished
+ * @param[in] *async pointer to an iic async structure
+ * @note      the writes of the done functions are visible to the caller afterwards
+ */
+void iic_async_wait(iic_async_t *async)
+{
+    pthread_mutex_lock(&async->mutex);
+    while ((async->num != 0) || (async->busy != 0))
+    {
+        pthread_cond_wait(&async->idle, &async->mutex);
+    }
+    pthread_mutex_unlock(&async->mutex);
+}
@@ -0,0 +1,345 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ring.c
+ * @brief     ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "ring.h"
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+/**
+ * @brief      create a ring
+ * @param[out] *ring pointer to a ring structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 create failed
+ * @note       used by the client, the handles are sent to the server afterwards
+ */
+uint8_t ring_create(ring_t *ring)
+{
+    void *p;
+    
+    /* create the shared memory */
+    ring->mem_fd = memfd_create("tea5767_ring", MFD_CLOEXEC);
+    if (ring->mem_fd < 0)
+    {
+        return 1;
+    }
+    if (ftruncate(ring->mem_fd, sizeof(ring_channel_t)) < 0)
+    {
+        (void)close(ring->mem_fd);
+        
+        return 1;
+    }
+    
+    /* create the doorbell */
+    ring->event_fd = eventfd(0, EFD_CLOEXEC);
+    if (ring->event_fd < 0)
+    {
+        (void)close(ring->mem_fd);
+        
+        return 1;
+    }
+    
+    /* map the channel */
+    p = mmap(NULL, sizeof(ring_channel_t), PROT_READ | PROT_WRITE, MAP_SHARED, ring->mem_fd, 0);
+    if (p == MAP_FAILED)
+    {
+        (void)close(ring->event_fd);
+        (void)close(ring->mem_fd);
+        
+        return 1;
+    }
+    ring->channel = (ring_channel_t *)p;
+    
+    /* the fresh memory is zero, so all rings are empty */
+    atomic_store_explicit(&ring->channel->doorbell, 1, memory_order_relaxed);
+    
+    return 0;
+}
+
+/**
+ * @brief      attach to a ring created by the peer
+ * @param[out] *ring pointer to a ring structure
+ * @param[in]  mem_fd shared memory handle
+ * @param[in]  event_fd doorbell handle
+ * @return     status code
+ *             - 0 success
+ *             - 1 attach failed
+ * @note       used by the server, the ring owns the handles afterwards
+ */
+uint8_t ring_attach(ring_t *ring, int mem_fd, int event_fd)
+{
+    struct stat st;
+    void *p;
+    
+    /* check the size */
+    ring->mem_fd = mem_fd;
+    ring->event_fd = event_fd;
+    ring->channel = NULL;
+    if ((fstat(mem_fd, &st) < 0) || (st.st_size < (off_t)sizeof(ring_channel_t)))
+    {
+        ring_close(ring);
+        
+        return 1;
+    }
+    
+    /* map the channel */
+    p = mmap(NULL, sizeof(ring_channel_t), PROT_READ | PROT_WRITE, MAP_SHARED, mem_fd, 0);
+    if (p == MAP_FAILED)
+    {
+        ring_close(ring);
+        
+        return 1;
+    }
+    ring->channel = (ring_channel_t *)p;
+    
+    /* never block on the doorbell */
+    (void)fcntl(event_fd, F_SETFL, fcntl(event_fd, F_GETFL, 0) | O_NONBLOCK);
+    
+    return 0;
+}
+
+/**
+ * @brief     close a ring
+ * @param[in] *ring pointer to a ring structure
+ * @note      none
+ */
+void ring_close(ring_t *ring)
+{
+    if (ring->channel != NULL)
+    {
+        (void)munmap(ring->channel, sizeof(ring_channel_t));
+        ring->channel = NULL;
+    }
+    if (ring->event_fd >= 0)
+    {
+        (void)close(ring->event_fd);
+        ring->event_fd = -1;
+    }
+    if (ring->mem_fd >= 0)
+    {
+        (void)close(ring->mem_fd);
+        ring->mem_fd = -1;
+    }
+}
+
+/**
+ * @brief     push a command
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *buf pointer to a command buffer
+ * @param[in] len command length
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ *            - 2 command is too long
+ * @note      the doorbell is only rung when the server sleeps
+ */
+uint8_t ring_push_command(ring_t *ring, const char *buf, uint16_t len)
+{
+    ring_channel_t *ch = ring->channel;
+    uint32_t head;
+    uint32_t tail;
+    uint64_t one;
+    
+    /* check the command */
+    if (len > RING_COMMAND_LEN)
+    {
+        return 2;
+    }
+    
+    /* check the space */
+    head = atomic_load_explicit(&ch->command_head, memory_order_relaxed);
+    tail = atomic_load_explicit(&ch->command_tail, memory_order_acquire);
+    if ((head - tail) >= RING_SLOT_NUM)
+    {
+        return 1;
+    }
+    
+    /* publish the command */
+    memcpy(ch->command[head % RING_SLOT_NUM].buf, buf, len);
+    ch->command[head % RING_SLOT_NUM].len = len;
+    atomic_store_explicit(&ch->command_head, head + 1, memory_order_release);
+    
+    /* pairs with the fence in ring_sleep, so either the server sees the command or we see the doorbell */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&ch->doorbell, memory_order_relaxed) != 0)
+    {
+        one = 1;
+        (void)write(ring->event_fd, &one, sizeof(one));
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      pop a command
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *buf pointer to a command buffer
+ * @param[out] *len pointer to a command length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ * @note       the buffer must hold RING_COMMAND_LEN bytes
+ */
+uint8_t ring_pop_command(ring_t *ring, char *buf, uint16_t *len)
+{
+    ring_channel_t *ch = ring->channel;
+    uint32_t head;
+    uint32_t tail;
+    
+    /* check the data */
+    tail = atomic_load_explicit(&ch->command_tail, memory_order_relaxed);
+    head = atomic_load_explicit(&ch->command_head, memory_order_acquire);
+    if (head == tail)
+    {
+        return 1;
+    }
+    
+    /* copy the command, the length is checked because the peer owns the memory too */
+    *len = ch->command[tail % RING_SLOT_NUM].len;
+    if (*len > RING_COMMAND_LEN)
+    {
+        *len = RING_COMMAND_LEN;
+    }
+    memcpy(buf, ch->command[tail % RING_SLOT_NUM].buf, *len);
+    atomic_store_explicit(&ch->command_tail, tail + 1, memory_order_release);
+    
+    return 0;
+}
+
+/**
+ * @brief     push a status
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] status status code
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ * @note      none
+ */
+uint8_t ring_push_status(ring_t *ring, uint8_t status)
+{
+    ring_channel_t *ch = ring->channel;
+    uint32_t head;
+    uint32_t tail;
+    
+    /* check the space */
+    head = atomic_load_explicit(&ch->status_head, memory_order_relaxed);
+    tail = atomic_load_explicit(&ch->status_tail, memory_order_acquire);
+    if ((head - tail) >= RING_SLOT_NUM)
+    {
+        return 1;
+    }
+    
+    /* publish the status */
+    ch->status[head % RING_SLOT_NUM] = status;
+    atomic_store_explicit(&ch->status_head, head + 1, memory_order_release);
+    
+    return 0;
+}
+
+/**
+ * @brief      pop a status
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ * @note       none
+ */
+uint8_t ring_pop_status(ring_t *ring, uint8_t *status)
+{
+    ring_channel_t *ch = ring->channel;
+    uint32_t head;
+    uint32_t tail;
+    
+    /* check the data */
+    tail = atomic_load_explicit(&ch->status_tail, memory_order_relaxed);
+    head = atomic_load_explicit(&ch->status_head, memory_order_acquire);
+    if (head == tail)
+    {
+        return 1;
+    }
+    
+    /* copy the status */
+    *status = ch->status[tail % RING_SLOT_NUM];
+    atomic_store_explicit(&ch->status_tail, tail + 1, memory_order_release);
+    
+    return 0;
+}
+
+/**
+ * @brief     arm the doorbell before the server sleeps
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 server can sleep
+ *            - 1 commands are pending
+ * @note      none
+ */
+uint8_t ring_sleep(ring_t *ring)
+{
+    ring_channel_t *ch = ring->channel;
+    
+    /* arm the doorbell, then check a command pushed before the client saw it */
+    atomic_store_explicit(&ch->doorbell, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&ch->command_head, memory_order_acquire) !=
+        atomic_load_explicit(&ch->command_tail, memory_order_relaxed))
+    {
+        atomic_store_explicit(&ch->doorbell, 0, memory_order_relaxed);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     disarm the doorbell after the server wakes up
+ * @param[in] *ring pointer to a ring structure
+ * @note      none
+ */
+void ring_wake(ring_t *ring)
+{
+    uint64_t cnt;
+    
+    /* clear the doorbell */
+    atomic_store_explicit(&ring->channel->doorbell, 0, memory_order_relaxed);
+    (void)read(ring->event_fd, &cnt, sizeof(cnt));
+}
@@ -38,6 +38,33 @@
 
 static shell_t gs_shell;        /**< shell handle */
 
+/**
+ * @brief shell hash definition
+ */
+#define SHELL_HASH_BASIS    2166136261U        /**< fnv-1a offset basis */
+#define SHELL_HASH_PRIME    16777619U          /**< fnv-1a prime */
+
+/**
+ * @brief     shell hash a string
+ * @param[in] *str pointer to a string
+ * @return    hash
+ * @note      fnv-1a, the same hash is built for the command name in the pretreatment
+ */
+static uint32_t a_shell_hash(const char *str)
+{
+    uint32_t hash;
+    
+    hash = SHELL_HASH_BASIS;
+    while (*str != '\0')
+    {
+        hash ^= (uint8_t)(*str);
+        hash *= SHELL_HASH_PRIME;
+        str++;
+    }
+    
+    return hash;
+}
+
 /**
  * @brief      shell pretreatment
  * @param[in]  *buf pointer to an in data buffer
@@ -45,19 +72,22 @@ static shell_t gs_shell;        /**< shell handle */
  * @param[out] *buf_out pointer to an out data buffer
  * @param[out] *out_len pointer to the length of a out data buffer
  * @param[out] **argv pointer to a argv buffer
+ * @param[out] *hash pointer to a command name hash buffer
  * @param[out] *argc pointer to a argc buffer
  * @return     status code
  *             - 0 success
  *             - 1 pretreatment failed
- * @note       none
+ * @note       the command name is hashed while it is copied
  */
-static uint8_t a_shell_pretreatment(char *buf, uint16_t in_len, char *buf_out, uint16_t *out_len, char **argv, uint8_t *argc)
+static uint8_t a_shell_pretreatment(char *buf, uint16_t in_len, char *buf_out, uint16_t *out_len,
+                                    char **argv, uint32_t *hash, uint8_t *argc)
 {
     uint16_t i;
     uint8_t flag = 0;
   
     *out_len = 0;
     *argc = 0;
+    *hash = SHELL_HASH_BASIS;
     flag = 1;
     for (i = 0; i < in_len; i++)
     {
@@ -67,12 +97,16 @@ static uint8_t a_shell_pretreatment(char *buf, uint16_t in_len, char *buf_out, u
             (*out_len)++;
             if (flag == 1)
             {
-                argv[(*argc)] = &buf_out[(*out_len-1)];
-                (*argc)++; 
-                if((*argc) >= SHELL_MAX_SIZE)
+                if((*argc) >= SHELL_MAX_SIZE - 1)
                 {
                     return 1;
                 }
+                argv[(*argc)] = &buf_out[(*out_len-1)];
+                (*argc)++; 
+            }
+            if ((*argc) == 1)
+            {
+                *hash = ((*hash) ^ (uint8_t)buf[i]) * SHELL_HASH_PRIME;
             }
             flag = 0;
         }
@@ -86,29 +120,44 @@ static uint8_t a_shell_pretreatment(char *buf, uint16_t in_len, char *buf_out, u
             }
         }
     }
+    buf_out[(*out_len)] = 0;
+    argv[(*argc)] = NULL;
     
     return 0;
 }
 
 /**
- * @brief     shell find function
- * @param[in] *handle pointer to a shell structure
- * @param[in] *name pointer to a name buffer
- * @return    status code
- *            - 0 success
- *            - 1 find failed
- * @note      none
+ * @brief      shell find function
+ * @param[in]  *handle pointer to a shell structure
+ * @param[in]  *name pointer to a name buffer
+ * @param[in]  hash name hash
+ * @param[out] **fuc pointer to a function buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 find failed
+ * @note       linear probing, a name is only compared when its hash matches
  */
-static uint8_t a_shell_find(shell_t *handle, char *name)
+static uint8_t a_shell_find(shell_t *handle, char *name, uint32_t hash, function_t **fuc)
 {
     uint16_t i;
+    uint16_t pos;
+    uint8_t index;
     
-    for (i = 0; i < SHELL_MAX_REG_SIZE; i++)
+    pos = (uint16_t)(hash & (SHELL_HASH_SIZE - 1));
+    for (i = 0; i < SHELL_HASH_SIZE; i++)
     {
-       if (strcmp(handle->fuc[i].name, name) == 0)
-       {
-           return 0;
-       }
+        index = handle->table[pos];
+        if (index == 0)
+        {
+            return 1;
+        }
+        if ((handle->fuc[index - 1].hash == hash) && (strcmp(handle->fuc[index - 1].name, name) == 0))
+        {
+            *fuc = &handle->fuc[index - 1];
+            
+            return 0;
+        }
+        pos = (pos + 1) & (SHELL_HASH_SIZE - 1);
     }
     
     return 1;
@@ -116,7 +165,7 @@ static uint8_t a_shell_find(shell_t *handle, char *name)
 
 /**
  * @brief     shell run function
- * @param[in] *handle pointer to a shell structure
+ * @param[in] *fuc pointer to a function
  * @param[in] argc number of param
  * @param[in] **argv param
  * @return    status code
@@ -125,19 +174,11 @@ static uint8_t a_shell_find(shell_t *handle, char *name)
  *            - 2 find function failed
  * @note      none
  */
-static uint8_t a_shell_run(shell_t *handle, uint8_t argc, char **argv)
+static uint8_t a_shell_run(function_t *fuc, uint8_t argc, char **argv)
 {
-    uint16_t i;
-    
-    for (i = 0; i < SHELL_MAX_REG_SIZE; i++)
+    if (fuc->fuc != NULL)
     {
-        if (strcmp(handle->fuc[i].name, argv[0]) == 0)
-        {
-            if (handle->fuc[i].fuc != NULL)
-            {
-                return handle->fuc[i].fuc(argc, argv);
-            }
-        }
+        return fuc->fuc(argc, argv);
     }
     
     return 2;
@@ -150,19 +191,36 @@ static uint8_t a_shell_run(shell_t *handle, uint8_t argc, char **argv)
  * @return    status code
  *            - 0 success
  *            - 1 buffer is full
- * @note      none
+ * @note      the name is hashed once here, the first registered function wins a duplicated name
  */
 uint8_t shell_register(char *name, uint8_t (*fuc)(uint8_t argc, char **argv))
 {
+    function_t *f;
+    function_t *found;
+    uint16_t pos;
+    
     if (gs_shell.fuc_i >= SHELL_MAX_REG_SIZE)
     {
         return 1;
     }
     
-    strncpy(gs_shell.fuc[gs_shell.fuc_i].name, name, SHELL_MAX_NAME);
-    gs_shell.fuc[gs_shell.fuc_i].fuc = fuc;
+    f = &gs_shell.fuc[gs_shell.fuc_i];
+    strncpy(f->name, name, SHELL_MAX_NAME - 1);
+    f->hash = a_shell_hash(f->name);
+    f->fuc = fuc;
     gs_shell.fuc_i++;
     
+    /* insert into the hash table */
+    if (a_shell_find(&gs_shell, f->name, f->hash, &found) != 0)
+    {
+        pos = (uint16_t)(f->hash & (SHELL_HASH_SIZE - 1));
+        while (gs_shell.table[pos] != 0)
+        {
+            pos = (pos + 1) & (SHELL_HASH_SIZE - 1);
+        }
+        gs_shell.table[pos] = (uint8_t)gs_shell.fuc_i;
+    }
+    
     return 0;
 }
 
@@ -189,27 +247,29 @@ uint8_t shell_init(void)
  *            - 2 find function failed
  *            - 3 length is too big
  *            - 4 pretreat failed
- * @note      none
+ * @note      the command name is hashed while it is split, so the function is found in constant time
  */
 uint8_t shell_parse(char *buf, uint16_t len)
 {
     uint8_t argc;
     uint16_t out_len;
+    uint32_t hash;
+    function_t *fuc;
     
-    if (len > SHELL_MAX_BUF_SIZE)
+    if (len > SHELL_MAX_BUF_SIZE - 1)
     {
         return 3;
     }
     
-    memset(&gs_shell.buf_out, 0 , sizeof(uint8_t) * SHELL_MAX_BUF_SIZE);
-    if (a_shell_pretreatment(buf, len, gs_shell.buf_out, (uint16_t *)&out_len, gs_shell.argv, (uint8_t *)(&argc)) != 0)
+    if (a_shell_pretreatment(buf, len, gs_shell.buf_out, (uint16_t *)&out_len, 
+                             gs_shell.argv, (uint32_t *)&hash, (uint8_t *)(&argc)) != 0)
     {
         return 4;
     }
-    if (a_shell_find(&gs_shell, (char *)gs_shell.argv[0]) != 0)
+    if ((argc == 0) || (a_shell_find(&gs_shell, (char *)gs_shell.argv[0], hash, &fuc) != 0))
     {
         return 2;
     } 
     
-    return a_shell_run(&gs_shell, argc, (char **)gs_shell.argv);
+    return a_shell_run(fuc, argc, (char **)gs_shell.argv);
 }
@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      simulator_driver_tea5767_interface.c
+ * @brief     simulator driver tea5767 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_interface.h"
+#include "driver_tea5767_simulator.h"
+#include <stdarg.h>
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   none
+ */
+uint8_t tea5767_interface_iic_init(void)
+{
+    return tea5767_simulator_iic_init();
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 iic deinit failed
+ * @note   none
+ */
+uint8_t tea5767_interface_iic_deinit(void)
+{
+    return tea5767_simulator_iic_deinit();
+}
+
+/**
+ * @brief     interface iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t tea5767_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return tea5767_simulator_iic_write_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t tea5767_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return tea5767_simulator_iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus write read command
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       sends the write and the read one after another
+ */
+uint8_t tea5767_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    if (tea5767_simulator_iic_write_cmd(addr, wbuf, wlen) != 0)
+    {
+        return 1;
+    }
+    
+    return tea5767_simulator_iic_read_cmd(addr, rbuf, rlen);
+}
+
+/**
+ * @brief     interface iic bus write command on a bus context
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      ctx is a tea5767_simulator_t
+ */
+uint8_t tea5767_interface_iic_write_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return tea5767_simulator_write((tea5767_simulator_t *)ctx, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       ctx is a tea5767_simulator_t
+ */
+uint8_t tea5767_interface_iic_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return tea5767_simulator_read((tea5767_simulator_t *)ctx, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus write read command on a bus context
+ * @param[in]  *ctx pointer to the bus context of the handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       ctx is a tea5767_simulator_t, sends the write and the read one after another
+ */
+uint8_t tea5767_interface_iic_write_read_ctx_cmd(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                                 uint8_t *rbuf, uint16_t rlen)
+{
+    if (tea5767_simulator_write((tea5767_simulator_t *)ctx, addr, wbuf, wlen) != 0)
+    {
+        return 1;
+    }
+    
+    return tea5767_simulator_read((tea5767_simulator_t *)ctx, addr, rbuf, rlen);
+}
+
+/**
+ * @brief     interface iic bus read submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the read finishes,
+ *            done is not called when the submit fails,
+ *            the simulator finishes the read before returning
+ */
+uint8_t tea5767_interface_iic_read_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                          tea5767_async_done_t done, void *arg)
+{
+    (void)ctx;
+    
+    done(arg, tea5767_simulator_iic_read_cmd(addr, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write submit
+ * @param[in] *ctx pointer to the bus context of the handle
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @param[in] done pointer to a done function address
+ * @param[in] *arg pointer to the done argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      returns at once and calls done(arg, res) when the write finishes,
+ *            done is not called when the submit fails,
+ *            the simulator finishes the write before returning
+ */
+uint8_t tea5767_interface_iic_write_submit(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                           tea5767_async_done_t done, void *arg)
+{
+    (void)ctx;
+    
+    done(arg, tea5767_simulator_iic_write_cmd(addr, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      advances the simulator clock instead of sleeping
+ */
+void tea5767_interface_delay_ms(uint32_t ms)
+{
+    tea5767_simulator_delay_ms(ms);
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void tea5767_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
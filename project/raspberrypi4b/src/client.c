@@ -34,10 +34,18 @@
  * </table>
  */
 
+#include "ring.h"
+#include "driver_tea5767_telemetry.h"
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/un.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <poll.h>
+#include <sched.h>
+#include <time.h>
 #include <unistd.h>
 #include <string.h>
 #include <stdlib.h>
@@ -49,8 +57,417 @@
 uint8_t g_buf[256];                              /**< uart buffer */
 volatile uint16_t g_len;                         /**< uart buffer length */
 static int gs_sock_fd;                           /**< network handle */
-static int gs_conn_fd;                           /**< network handle */
 static struct sockaddr_in gs_server_addr;        /**< server address */
+static char gs_rx[256];                          /**< received responses */
+static uint16_t gs_rx_len;                       /**< received length */
+static uint8_t gs_mode;                          /**< connection mode */
+static ring_t gs_ring;                           /**< shared memory ring */
+
+/**
+ * @brief client definition
+ */
+#define CLIENT_MODE_TCP        0                        /**< tcp connection */
+#define CLIENT_MODE_UNIX       1                        /**< local seqpacket connection */
+#define CLIENT_MODE_RING       2                        /**< local connection with a shared memory ring */
+#define CLIENT_UNIX_PATH       "/tmp/tea5767.sock"      /**< local socket path */
+#define CLIENT_TELEMETRY_PATH  "/dev/shm/tea5767_telemetry"    /**< telemetry ring path */
+#define CLIENT_SPIN_US         2000                     /**< busy wait time of a ring status */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_time_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief  connect to the server
+ * @return status code
+ *         - 0 success
+ *         - 1 connect failed
+ * @note   none
+ */
+static uint8_t a_connect(void)
+{
+    struct sockaddr_un addr;
+    
+    /* tcp connection */
+    if (gs_mode == CLIENT_MODE_TCP)
+    {
+        /* creat a socket */
+        gs_sock_fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (gs_sock_fd < 0) 
+        {
+            printf("tea5767: creat socket failed.\n");
+            
+            return 1;
+        }
+        
+        /* set connect port */
+        memset(&gs_server_addr,0,sizeof(gs_server_addr));
+        gs_server_addr.sin_family = AF_INET;
+        gs_server_addr.sin_port = htons(6666);
+        
+        /* set the server address */
+        if (inet_pton(AF_INET, "127.0.0.1", &gs_server_addr.sin_addr) < 0) 
+        {
+            printf("tea5767: set address failed.\n");
+            (void)close(gs_sock_fd);
+            
+            return 1;
+        }
+        
+        /* connect to the server */
+        if (connect(gs_sock_fd, (struct sockaddr*)&gs_server_addr, sizeof(gs_server_addr)) <0) 
+        {
+            printf("tea5767: connect failed.\n");
+            (void)close(gs_sock_fd);
+            
+            return 1;
+        }
+        
+        return 0;
+    }
+    
+    /* creat a local socket */
+    gs_sock_fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (gs_sock_fd < 0) 
+    {
+        printf("tea5767: creat socket failed.\n");
+        
+        return 1;
+    }
+    
+    /* connect to the server */
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, CLIENT_UNIX_PATH, sizeof(addr.sun_path) - 1);
+    if (connect(gs_sock_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) 
+    {
+        printf("tea5767: connect failed.\n");
+        (void)close(gs_sock_fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  attach a shared memory ring to the connection
+ * @return status code
+ *         - 0 success
+ *         - 1 attach failed
+ * @note   the memfd and the eventfd are passed to the server in one message
+ */
+static uint8_t a_ring_init(void)
+{
+    char control[CMSG_SPACE(2 * sizeof(int))];
+    char data[8];
+    int fds[2];
+    struct msghdr msg;
+    struct iovec iov;
+    struct cmsghdr *cmsg;
+    ssize_t n;
+    
+    /* create the ring */
+    if (ring_create(&gs_ring) != 0)
+    {
+        printf("tea5767: create ring failed.\n");
+        
+        return 1;
+    }
+    
+    /* send the handles */
+    memset(&msg, 0, sizeof(msg));
+    memset(control, 0, sizeof(control));
+    iov.iov_base = "ring";
+    iov.iov_len = 4;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    fds[0] = gs_ring.mem_fd;
+    fds[1] = gs_ring.event_fd;
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    if (sendmsg(gs_sock_fd, &msg, 0) < 0)
+    {
+        printf("tea5767: send ring failed.\n");
+        ring_close(&gs_ring);
+        
+        return 1;
+    }
+    
+    /* wait the response */
+    n = recv(gs_sock_fd, data, sizeof(data) - 1, 0);
+    if ((n <= 0) || (data[0] != '0'))
+    {
+        printf("tea5767: attach ring failed.\n");
+        ring_close(&gs_ring);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      wait the next status of the ring
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 server closed
+ * @note       busy waits first, then sleeps between the checks for long commands
+ */
+static uint8_t a_ring_wait(uint8_t *status)
+{
+    struct pollfd fds;
+    uint64_t start;
+    
+    start = a_time_us();
+    while (ring_pop_status(&gs_ring, status) != 0)
+    {
+        /* let the server run on the same core */
+        (void)sched_yield();
+        if ((a_time_us() - start) > CLIENT_SPIN_US)
+        {
+            /* check the server while sleeping */
+            fds.fd = gs_sock_fd;
+            fds.events = POLLIN;
+            if (poll(&fds, 1, 1) != 0)
+            {
+                return (ring_pop_status(&gs_ring, status) == 0) ? 0 : 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stream the commands of stdin over the ring
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   one command per line, every command waits its status
+ */
+static uint8_t a_ring_stream(void)
+{
+    char line[256];
+    uint8_t status;
+    uint16_t len;
+    uint32_t cnt;
+    uint64_t start;
+    uint64_t total;
+    
+    cnt = 0;
+    total = 0;
+    while (fgets(line, sizeof(line), stdin) != NULL)
+    {
+        /* strip the newline */
+        len = (uint16_t)strcspn(line, "\r\n");
+        if (len == 0)
+        {
+            continue;
+        }
+        
+        /* run the command */
+        start = a_time_us();
+        if (ring_push_command(&gs_ring, line, len) != 0)
+        {
+            printf("tea5767: push failed.\n");
+            
+            return 1;
+        }
+        if (a_ring_wait(&status) != 0)
+        {
+            printf("tea5767: server closed.\n");
+            
+            return 1;
+        }
+        total += a_time_us() - start;
+        cnt++;
+        printf("tea5767: status %d.\n", status);
+    }
+    if (cnt != 0)
+    {
+        printf("tea5767: %u commands, %.1f us average round trip.\n", (unsigned int)cnt, (double)total / cnt);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  print the complete responses
+ * @return number of printed responses
+ * @note   none
+ */
+static uint32_t a_print_response(void)
+{
+    char *end;
+    uint16_t used;
+    uint32_t cnt;
+    
+    used = 0;
+    cnt = 0;
+    while ((end = memchr(gs_rx + used, '\n', gs_rx_len - used)) != NULL)
+    {
+        *end = '\0';
+        printf("tea5767: status %s.\n", gs_rx + used);
+        used = (uint16_t)(end - gs_rx + 1);
+        cnt++;
+    }
+    memmove(gs_rx, gs_rx + used, gs_rx_len - used);
+    gs_rx_len -= used;
+    
+    return cnt;
+}
+
+/**
+ * @brief  stream the commands of stdin over one connection
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   one command per line, commands are pipelined and every response is printed in order,
+ *         on a local connection every line is sent as one message
+ */
+static uint8_t a_stream(void)
+{
+    struct pollfd fds[2];
+    char line[256];
+    uint8_t eof;
+    uint32_t pending;
+    uint32_t cnt;
+    uint64_t start;
+    ssize_t n;
+    
+    eof = 0;
+    pending = 0;
+    cnt = 0;
+    start = a_time_us();
+    gs_rx_len = 0;
+    while ((eof == 0) || (pending != 0))
+    {
+        /* wait stdin and the socket */
+        fds[0].fd = (eof == 0) ? 0 : -1;
+        fds[0].events = POLLIN;
+        fds[1].fd = gs_sock_fd;
+        fds[1].events = POLLIN;
+        if (poll(fds, 2, -1) < 0)
+        {
+            return 1;
+        }
+        
+        /* send the next command */
+        if ((fds[0].revents & (POLLIN | POLLHUP)) != 0)
+        {
+            if (fgets(line, sizeof(line), stdin) == NULL)
+            {
+                eof = 1;
+                (void)shutdown(gs_sock_fd, SHUT_WR);
+            }
+            else if ((line[0] != '\n') && (line[0] != '\0'))
+            {
+                if (strchr(line, '\n') == NULL)
+                {
+                    strcat(line, "\n");
+                }
+                if (send(gs_sock_fd, line, strlen(line), 0) < 0)
+                {
+                    printf("tea5767: send failed.\n");
+                    
+                    return 1;
+                }
+                pending++;
+                cnt++;
+            }
+        }
+        
+        /* read the responses */
+        if ((fds[1].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+        {
+            n = recv(gs_sock_fd, gs_rx + gs_rx_len, sizeof(gs_rx) - gs_rx_len, 0);
+            if (n <= 0)
+            {
+                break;
+            }
+            gs_rx_len += (uint16_t)n;
+            pending -= a_print_response();
+        }
+    }
+    if ((cnt != 0) && (pending == 0))
+    {
+        printf("tea5767: %u commands, %.1f us per command.\n", (unsigned int)cnt, (double)(a_time_us() - start) / cnt);
+    }
+    
+    return (pending == 0) ? 0 : 1;
+}
+
+/**
+ * @brief     print the telemetry samples of the server
+ * @param[in] num sample number, 0 means forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the shared sample ring is read lock free, no command is sent
+ */
+static uint8_t a_telemetry(uint32_t num)
+{
+    tea5767_telemetry_ring_t *ring;
+    tea5767_telemetry_reader_t reader;
+    tea5767_telemetry_sample_t sample;
+    uint32_t cnt;
+    void *p;
+    int fd;
+    
+    /* map the ring */
+    fd = open(CLIENT_TELEMETRY_PATH, O_RDONLY);
+    if (fd < 0)
+    {
+        printf("tea5767: open telemetry ring failed.\n");
+        
+        return 1;
+    }
+    p = mmap(NULL, sizeof(tea5767_telemetry_ring_t), PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (p == MAP_FAILED)
+    {
+        printf("tea5767: map telemetry ring failed.\n");
+        
+        return 1;
+    }
+    ring = (tea5767_telemetry_ring_t *)p;
+    
+    /* print the samples */
+    cnt = 0;
+    (void)tea5767_telemetry_subscribe(ring, &reader);
+    while ((num == 0) || (cnt < num))
+    {
+        if (tea5767_telemetry_read(ring, &reader, &sample) != 0)
+        {
+            (void)usleep(1000);
+            
+            continue;
+        }
+        printf("tea5767: %ums %uKHz level 0x%02X if 0x%02X %s lost %u.\n", (unsigned int)sample.timestamp_ms, 
+               (unsigned int)sample.khz, sample.level, sample.if_out, (sample.reception == 0) ? "mono" : "stereo", (unsigned int)reader.lost);
+        cnt++;
+    }
+    (void)munmap(p, sizeof(tea5767_telemetry_ring_t));
+    
+    return 0;
+}
 
 /**
  * @brief     main function
@@ -59,42 +476,57 @@ static struct sockaddr_in gs_server_addr;        /**< server address */
  * @return    status code
  *            - 0 success
  *            - 1 run failed
- * @note      none
+ * @note      without arguments, commands are read from stdin and sent over one connection,
+ *            a leading --unix selects the local socket and --ring the shared memory ring,
+ *            --telemetry [num] prints the telemetry samples of the server
  */
 int main(uint8_t argc, char **argv)
 {
     uint8_t *p;
+    uint8_t res;
+    ssize_t n;
     
-    /* creat a socket */
-    gs_sock_fd = socket(AF_INET, SOCK_STREAM, 0);
-    if (gs_sock_fd < 0) 
+    /* telemetry mode */
+    if ((argc > 1) && (strcmp(argv[1], "--telemetry") == 0))
     {
-        printf("tea5767: creat socket failed.\n");
-       
-        return 1;
+        return a_telemetry((argc > 2) ? (uint32_t)atoi(argv[2]) : 0);
+    }
+    
+    /* select the connection */
+    gs_mode = CLIENT_MODE_TCP;
+    if ((argc > 1) && ((strcmp(argv[1], "--unix") == 0) || (strcmp(argv[1], "--ring") == 0)))
+    {
+        gs_mode = (strcmp(argv[1], "--unix") == 0) ? CLIENT_MODE_UNIX : CLIENT_MODE_RING;
+        argv[1] = argv[0];
+        argv++;
+        argc--;
     }
     
-    /* set connect port */
-    memset(&gs_server_addr,0,sizeof(gs_server_addr));
-    gs_server_addr.sin_family = AF_INET;
-    gs_server_addr.sin_port = htons(6666);
+    /* connect to the server */
+    if (a_connect() != 0)
+    {
+        return 1;
+    }
     
-    /* set the server address */
-    if (inet_pton(AF_INET, "127.0.0.1", &gs_server_addr.sin_addr) < 0) 
+    /* attach the ring */
+    if ((gs_mode == CLIENT_MODE_RING) && (a_ring_init() != 0))
     {
-        printf("tea5767: set address failed.\n");
         (void)close(gs_sock_fd);
-
+        
         return 1;
     }
     
-    /* connect to the server */
-    if (connect(gs_sock_fd, (struct sockaddr*)&gs_server_addr, sizeof(gs_server_addr)) <0) 
+    /* stream mode */
+    if (argc < 2)
     {
-        printf("tea5767: connect failed.\n");
+        res = (gs_mode == CLIENT_MODE_RING) ? a_ring_stream() : a_stream();
+        if (gs_mode == CLIENT_MODE_RING)
+        {
+            ring_close(&gs_ring);
+        }
         (void)close(gs_sock_fd);
-
-        return 1;
+        
+        return res;
     }
     
     /* cat the full command */
@@ -120,7 +552,22 @@ int main(uint8_t argc, char **argv)
     /* output */
     printf("tea5767: send %s\n", p);
     
+    /* run over the ring */
+    if (gs_mode == CLIENT_MODE_RING)
+    {
+        res = 1;
+        if ((ring_push_command(&gs_ring, (char *)p, g_len - 1) == 0) && (a_ring_wait(&res) == 0))
+        {
+            printf("tea5767: status %d.\n", res);
+        }
+        ring_close(&gs_ring);
+        (void)close(gs_sock_fd);
+        
+        return (res == 0) ? 0 : 1;
+    }
+    
     /* send data */
+    p[g_len - 1] = '\n';
     if (send(gs_sock_fd, p, g_len, 0) <0) 
     {
         printf("tea5767: send failed.\n");
@@ -129,8 +576,28 @@ int main(uint8_t argc, char **argv)
         return 1;
     }
     
+    /* wait the response */
+    gs_rx_len = 0;
+    res = 1;
+    while (gs_rx_len < sizeof(gs_rx))
+    {
+        n = recv(gs_sock_fd, gs_rx + gs_rx_len, sizeof(gs_rx) - gs_rx_len, 0);
+        if (n <= 0)
+        {
+            break;
+        }
+        gs_rx_len += (uint16_t)n;
+        if (memchr(gs_rx, '\n', gs_rx_len) != NULL)
+        {
+            res = (atoi(gs_rx) == 0) ? 0 : 1;
+            (void)a_print_response();
+            
+            break;
+        }
+    }
+    
     /* close the socket */
     (void)close(gs_sock_fd);
     
-    return 0;
+    return res;
 }
@@ -36,15 +36,38 @@
 
 #include "driver_tea5767_register_test.h"
 #include "driver_tea5767_radio_test.h"
+#include "driver_tea5767_replay_test.h"
+#include "driver_tea5767_telemetry_test.h"
+#include "driver_tea5767_afc_test.h"
+#include "driver_tea5767_tune_test.h"
+#include "driver_tea5767_preset_test.h"
+#include "driver_tea5767_stats_test.h"
+#include "driver_tea5767_sched_test.h"
 #include "driver_tea5767_basic.h"
+#include "driver_tea5767_stats.h"
 #include "shell.h"
+#include "benchmark.h"
+#include "ring.h"
+#include "binary.h"
+#ifdef TEA5767_SIMULATOR
+#include "driver_tea5767_simulator.h"
+#endif
 #include <getopt.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 #include <netinet/in.h>
 #include <signal.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sched.h>
 
 /**
  * @brief global var definition
@@ -52,9 +75,418 @@
 uint8_t g_buf[256];                              /**< uart buffer */
 volatile uint16_t g_len;                         /**< uart buffer length */
 static int gs_listen_fd;                         /**< network handle */
-static int gs_conn_fd;                           /**< network handle */
+static int gs_unix_fd;                           /**< local network handle */
+static int gs_epoll_fd;                          /**< epoll handle */
+static int gs_timer_fd = -1;                     /**< telemetry timer handle */
+static tea5767_telemetry_ring_t *gs_telemetry_ring;        /**< telemetry ring in shared memory */
+static tea5767_preset_store_t *gs_preset;                  /**< preset store mapped from a file */
+static tea5767_trace_t gs_trace;                           /**< bus trace */
+static tea5767_stats_t gs_stats;                           /**< operation stats */
 static struct sockaddr_in gs_server_addr;        /**< server address */
 
+/**
+ * @brief server definition
+ */
+#define SERVER_MAX_CONN         16                            /**< max client connections */
+#define SERVER_MAX_EVENT        16                            /**< max events of one epoll wait */
+#define SERVER_IN_LEN           256                           /**< command buffer length of one connection */
+#define SERVER_OUT_LEN          1024                          /**< response buffer length of one connection */
+#define SERVER_RESPONSE_LEN     8                             /**< max length of one response */
+#define SERVER_UNIX_PATH        "/tmp/tea5767.sock"           /**< local socket path */
+#define SERVER_TCP_LISTEN       (SERVER_MAX_CONN)             /**< epoll tag of the tcp listen socket */
+#define SERVER_UNIX_LISTEN      (SERVER_MAX_CONN + 1)         /**< epoll tag of the local listen socket */
+#define SERVER_TELEMETRY_EVENT  (SERVER_MAX_CONN + 2)         /**< epoll tag of the telemetry timer */
+#define SERVER_TELEMETRY_PATH   "/dev/shm/tea5767_telemetry"  /**< telemetry ring path */
+#define SERVER_PRESET_PATH      "/var/tmp/tea5767_preset"     /**< preset store path */
+#define SERVER_TRACE_SIZE       1024                          /**< records of the bus trace ring */
+#define SERVER_RING_EVENT       0x100                         /**< epoll tag base of the ring doorbells */
+#define SERVER_RING_SPIN_US     1000                          /**< busy poll time of the rings after a command */
+
+/**
+ * @brief server connection structure definition
+ */
+typedef struct server_conn_s
+{
+    int fd;                          /**< connection handle, -1 means free */
+    uint32_t events;                 /**< registered epoll events */
+    uint16_t in_len;                 /**< received length */
+    uint16_t out_len;                /**< pending response length */
+    uint8_t discard;                 /**< discard until the next newline */
+    uint8_t packet;                  /**< local seqpacket connection flag */
+    uint8_t closing;                 /**< peer closed, close after the responses are sent */
+    ring_t ring;                     /**< shared memory ring, channel is NULL without ring */
+    char in[SERVER_IN_LEN];          /**< received commands */
+    char out[SERVER_OUT_LEN];        /**< pending responses */
+} server_conn_t;
+
+static server_conn_t gs_conn[SERVER_MAX_CONN];   /**< client connections */
+static tea5767_trace_record_t gs_trace_record[SERVER_TRACE_SIZE];        /**< bus trace ring */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_time_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief  telemetry init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the sample ring is mapped from a shared memory file, so local clients can subscribe to it
+ */
+static uint8_t a_telemetry_init(void)
+{
+    struct epoll_event ev;
+    void *p;
+    int fd;
+    
+    /* map the ring */
+    fd = open(SERVER_TELEMETRY_PATH, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        tea5767_interface_debug_print("tea5767: open telemetry ring failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(fd, sizeof(tea5767_telemetry_ring_t)) < 0)
+    {
+        tea5767_interface_debug_print("tea5767: open telemetry ring failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    p = mmap(NULL, sizeof(tea5767_telemetry_ring_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (p == MAP_FAILED)
+    {
+        tea5767_interface_debug_print("tea5767: map telemetry ring failed.\n");
+        
+        return 1;
+    }
+    gs_telemetry_ring = (tea5767_telemetry_ring_t *)p;
+    
+    /* creat the timer */
+    gs_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    if (gs_timer_fd < 0)
+    {
+        tea5767_interface_debug_print("tea5767: create timer failed.\n");
+        
+        return 1;
+    }
+    
+    /* watch the timer */
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u32 = SERVER_TELEMETRY_EVENT;
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, gs_timer_fd, &ev) < 0)
+    {
+        tea5767_interface_debug_print("tea5767: epoll add failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     start or stop the telemetry
+ * @param[in] period_ms sample period in ms, 0 stops sampling
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the timer wakes the server once per period
+ */
+static uint8_t a_telemetry_start(uint32_t period_ms)
+{
+    struct itimerspec its;
+    
+    /* only the server samples */
+    if (gs_telemetry_ring == NULL)
+    {
+        tea5767_interface_debug_print("tea5767: telemetry needs the server.\n");
+        
+        return 1;
+    }
+    
+    /* set the period */
+    if (tea5767_basic_telemetry_start(gs_telemetry_ring, period_ms, (uint32_t)(a_time_us() / 1000)) != 0)
+    {
+        return 1;
+    }
+    
+    /* set the timer */
+    memset(&its, 0, sizeof(its));
+    its.it_value.tv_sec = period_ms / 1000;
+    its.it_value.tv_nsec = (long)(period_ms % 1000) * 1000000L;
+    its.it_interval = its.it_value;
+    if (timerfd_settime(gs_timer_fd, 0, &its, NULL) < 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  take the due telemetry sample
+ * @note   none
+ */
+static void a_telemetry_event(void)
+{
+    uint64_t cnt;
+    
+    /* clear the timer */
+    (void)read(gs_timer_fd, &cnt, sizeof(cnt));
+    
+    /* sample */
+    if (tea5767_basic_telemetry_poll((uint32_t)(a_time_us() / 1000)) != 0)
+    {
+        tea5767_interface_debug_print("tea5767: telemetry poll failed.\n");
+    }
+}
+
+/**
+ * @brief  map the preset store
+ * @return status code
+ *         - 0 success
+ *         - 1 map failed
+ * @note   the store file is mapped on the first use, a missing or damaged store is reset
+ */
+static uint8_t a_preset_map(void)
+{
+    struct stat st;
+    void *p;
+    int fd;
+    
+    /* already mapped */
+    if (gs_preset != NULL)
+    {
+        return 0;
+    }
+    
+    /* open the store */
+    fd = open(SERVER_PRESET_PATH, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        tea5767_interface_debug_print("tea5767: open preset store failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(fd, &st) < 0) || (ftruncate(fd, sizeof(tea5767_preset_store_t)) < 0))
+    {
+        tea5767_interface_debug_print("tea5767: open preset store failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    p = mmap(NULL, sizeof(tea5767_preset_store_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (p == MAP_FAILED)
+    {
+        tea5767_interface_debug_print("tea5767: map preset store failed.\n");
+        
+        return 1;
+    }
+    gs_preset = (tea5767_preset_store_t *)p;
+    
+    /* check the store */
+    if (tea5767_preset_check(gs_preset, (uint32_t)st.st_size) != 0)
+    {
+        tea5767_interface_debug_print("tea5767: preset store is reset.\n");
+        (void)tea5767_preset_init(gs_preset);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  trace and stats clock
+ * @return time in us
+ * @note   none
+ */
+static uint32_t a_clock_us(void)
+{
+    return (uint32_t)a_time_us();
+}
+
+/**
+ * @brief     save the bus trace
+ * @param[in] *path pointer to a trace file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 save failed
+ * @note      the trace blob is the header followed by the records, oldest first
+ */
+static uint8_t a_trace_save(const char *path)
+{
+    tea5767_trace_header_t header;
+    tea5767_trace_record_t record;
+    uint32_t i;
+    FILE *fp;
+    
+    /* get the header */
+    if (tea5767_trace_get_header(&gs_trace, &header) != 0)
+    {
+        return 1;
+    }
+    
+    /* write the blob */
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+    {
+        tea5767_interface_debug_print("tea5767: open %s failed.\n", path);
+        
+        return 1;
+    }
+    if (fwrite(&header, sizeof(header), 1, fp) != 1)
+    {
+        tea5767_interface_debug_print("tea5767: write %s failed.\n", path);
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    for (i = 0; i < header.num; i++)
+    {
+        (void)tea5767_trace_get_record(&gs_trace, i, &record);
+        if (fwrite(&record, sizeof(record), 1, fp) != 1)
+        {
+            tea5767_interface_debug_print("tea5767: write %s failed.\n", path);
+            (void)fclose(fp);
+            
+            return 1;
+        }
+    }
+    (void)fclose(fp);
+    tea5767_interface_debug_print("tea5767: saved %d transfers, %d lost.\n", header.num, header.lost);
+    
+    return 0;
+}
+
+/**
+ * @brief     replay a saved bus trace
+ * @param[in] *path pointer to a trace file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 replay failed
+ * @note      none
+ */
+static uint8_t a_trace_replay(const char *path)
+{
+    struct stat st;
+    uint8_t res;
+    uint8_t *buf;
+    FILE *fp;
+    
+    /* read the blob */
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        tea5767_interface_debug_print("tea5767: open %s failed.\n", path);
+        
+        return 1;
+    }
+    if ((fstat(fileno(fp), &st) < 0) || (st.st_size < (off_t)sizeof(tea5767_trace_header_t)))
+    {
+        tea5767_interface_debug_print("tea5767: %s is not a trace.\n", path);
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    buf = (uint8_t *)malloc((size_t)st.st_size);
+    if (buf == NULL)
+    {
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    if (fread(buf, (size_t)st.st_size, 1, fp) != 1)
+    {
+        tea5767_interface_debug_print("tea5767: read %s failed.\n", path);
+        free(buf);
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    (void)fclose(fp);
+    
+    /* check the blob */
+    if (tea5767_trace_check((tea5767_trace_header_t *)buf, (uint32_t)st.st_size) != 0)
+    {
+        tea5767_interface_debug_print("tea5767: %s is not a trace.\n", path);
+        free(buf);
+        
+        return 1;
+    }
+    
+    /* replay */
+    res = tea5767_replay_trace((tea5767_trace_record_t *)(buf + sizeof(tea5767_trace_header_t)), 
+                               ((tea5767_trace_header_t *)buf)->num);
+    free(buf);
+    
+    return res;
+}
+
+/**
+ * @brief  print the operation stats
+ * @return status code
+ *         - 0 success
+ *         - 1 print failed
+ * @note   none
+ */
+static uint8_t a_stats_print(void)
+{
+    const char *name[TEA5767_STATS_OP_NUM] = {"iic read", "iic write", "iic write read", "write conf", 
+                                              "read conf", "write read conf", "read status", "search"};
+    tea5767_stats_t snapshot;
+    tea5767_stats_counter_t *counter;
+    uint32_t p50;
+    uint32_t p99;
+    uint8_t i;
+    uint8_t b;
+    
+    /* take a snapshot */
+    if (tea5767_stats_snapshot(&gs_stats, &snapshot, 0) != 0)
+    {
+        return 1;
+    }
+    
+    /* output */
+    for (i = 0; i < TEA5767_STATS_OP_NUM; i++)
+    {
+        counter = &snapshot.counter[i];
+        if (counter->count == 0)
+        {
+            tea5767_interface_debug_print("tea5767: %s 0 calls.\n", name[i]);
+            
+            continue;
+        }
+        (void)tea5767_stats_percentile(counter, 500, &p50);
+        (void)tea5767_stats_percentile(counter, 990, &p99);
+        tea5767_interface_debug_print("tea5767: %s %d calls %d failed, min %dus avg %dus max %dus p50 %dus p99 %dus.\n", 
+                                      name[i], counter->count, counter->fail, counter->min_us, 
+                                      (uint32_t)(counter->total_us / counter->count), counter->max_us, p50, p99);
+        for (b = 0; b < TEA5767_STATS_BUCKET_NUM; b++)
+        {
+            if (counter->bucket[b] != 0)
+            {
+                tea5767_interface_debug_print("tea5767: %s %dus - %dus %d.\n", name[i], 
+                                              (b == 0) ? 0 : (1UL << b), (2UL << b) - 1, counter->bucket[b]);
+            }
+        }
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     tea5767 full function
  * @param[in] argc arg numbers
@@ -69,22 +501,32 @@ uint8_t tea5767(uint8_t argc, char **argv)
 {
     int c;
     int longindex = 0;
-    const char short_options[] = "hipe:t:";
+    const char short_options[] = "hipb:e:s:t:";
     const struct option long_options[] =
     {
+        {"benchmark", required_argument, NULL, 'b'},
         {"help", no_argument, NULL, 'h'},
         {"information", no_argument, NULL, 'i'},
         {"port", no_argument, NULL, 'p'},
         {"example", required_argument, NULL, 'e'},
+        {"stats", required_argument, NULL, 's'},
         {"test", required_argument, NULL, 't'},
         {"crystal", required_argument, NULL, 1},
         {"freq", required_argument, NULL, 2},
+        {"period", required_argument, NULL, 3},
+        {"preset", required_argument, NULL, 4},
+        {"file", required_argument, NULL, 5},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     tea5767_clock_t crystal = TEA5767_CLOCK_32P768_KHZ;
     float freq = 0.0f;
     uint8_t freq_flag = 0;
+    uint32_t period = 0;
+    uint8_t period_flag = 0;
+    uint8_t preset = 0;
+    uint8_t preset_flag = 0;
+    const char *file = NULL;
     
     /* if no params */
     if (argc == 1)
@@ -135,6 +577,16 @@ uint8_t tea5767(uint8_t argc, char **argv)
                 break;
             }
             
+            /* benchmark */
+            case 'b' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "b_%s", optarg);
+                
+                break;
+            }
+            
             /* example */
             case 'e' :
             {
@@ -145,6 +597,16 @@ uint8_t tea5767(uint8_t argc, char **argv)
                 break;
             }
             
+            /* stats */
+            case 's' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "s_%s", optarg);
+                
+                break;
+            }
+            
             /* test */
             case 't' :
             {
@@ -189,6 +651,39 @@ uint8_t tea5767(uint8_t argc, char **argv)
                 break;
             }
             
+            /* period */
+            case 3 :
+            {
+                /* set the period */
+                period = (uint32_t)atoi(optarg);
+                period_flag = 1;
+                
+                break;
+            }
+            
+            /* preset */
+            case 4 :
+            {
+                /* set the preset */
+                if ((atoi(optarg) < 0) || (atoi(optarg) >= TEA5767_PRESET_MAX))
+                {
+                    return 5;
+                }
+                preset = (uint8_t)atoi(optarg);
+                preset_flag = 1;
+                
+                break;
+            }
+            
+            /* file */
+            case 5 :
+            {
+                /* set the file */
+                file = optarg;
+                
+                break;
+            }
+            
             /* the end */
             case -1 :
             {
@@ -228,53 +723,180 @@ uint8_t tea5767(uint8_t argc, char **argv)
             return 0;
         }
     }
-    else if (strcmp("e_init", type) == 0)
+    else if (strcmp("t_replay", type) == 0)
     {
-        /* basic init */
-        if (tea5767_basic_init() != 0)
+        /* run replay test or replay a saved trace */
+        if (((file == NULL) ? tea5767_replay_test() : a_trace_replay(file)) != 0)
         {
             return 1;
         }
         else
         {
-            tea5767_interface_debug_print("tea5767: init successful.\n");
-            
             return 0;
         }
     }
-    else if (strcmp("e_deinit", type) == 0)
+    else if (strcmp("t_telemetry", type) == 0)
     {
-        /* basic deinit */
-        if (tea5767_basic_deinit() != 0)
+        /* run telemetry test */
+        if (tea5767_telemetry_test() != 0)
         {
             return 1;
         }
         else
         {
-            tea5767_interface_debug_print("tea5767: deinit successful.\n");
-            
             return 0;
         }
     }
-    else if (strcmp("e_up", type) == 0)
+    else if (strcmp("t_afc", type) == 0)
     {
-        float mhz;
-        
-        /* basic up */
-        if (tea5767_basic_search_up() != 0)
+        /* run afc test */
+        if (tea5767_afc_test() != 0)
         {
             return 1;
         }
         else
         {
-            /* get freq */
-            if (tea5767_basic_get_frequency(&mhz) != 0)
-            {
-                return 1;
-            }
-            tea5767_interface_debug_print("tea5767: search up successful.\n");
-            tea5767_interface_debug_print("tea5767: frequency is %0.2fMHz.\n", mhz);
-            
+            return 0;
+        }
+    }
+    else if (strcmp("t_tune", type) == 0)
+    {
+        /* run tune test */
+        if (tea5767_tune_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_preset", type) == 0)
+    {
+        /* run preset test */
+        if (tea5767_preset_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_stats", type) == 0)
+    {
+        /* run stats test */
+        if (tea5767_stats_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_sched", type) == 0)
+    {
+        /* run sched test */
+        if (tea5767_sched_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("b_convert", type) == 0)
+    {
+        /* run convert benchmark */
+        if (benchmark_convert(100) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("b_accessor", type) == 0)
+    {
+        /* run accessor benchmark */
+        if (benchmark_accessor(1000000) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+#ifdef TEA5767_SIMULATOR
+    else if (strcmp("b_pool", type) == 0)
+    {
+        /* run pool benchmark */
+        if (benchmark_pool(4) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+#endif
+    else if (strcmp("e_init", type) == 0)
+    {
+        /* basic init */
+        if (tea5767_basic_init() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            /* the server counts the operations of the new handle */
+            if (gs_stats.clock_us != NULL)
+            {
+                (void)tea5767_basic_stats(&gs_stats);
+            }
+            tea5767_interface_debug_print("tea5767: init successful.\n");
+            
+            return 0;
+        }
+    }
+    else if (strcmp("e_deinit", type) == 0)
+    {
+        /* basic deinit */
+        if (tea5767_basic_deinit() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            tea5767_interface_debug_print("tea5767: deinit successful.\n");
+            
+            return 0;
+        }
+    }
+    else if (strcmp("e_up", type) == 0)
+    {
+        float mhz;
+        
+        /* basic up */
+        if (tea5767_basic_search_up() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            /* get freq */
+            if (tea5767_basic_get_frequency(&mhz) != 0)
+            {
+                return 1;
+            }
+            tea5767_interface_debug_print("tea5767: search up successful.\n");
+            tea5767_interface_debug_print("tea5767: frequency is %0.2fMHz.\n", mhz);
+            
             return 0;
         }
     }
@@ -364,6 +986,141 @@ uint8_t tea5767(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("e_telemetry", type) == 0)
+    {
+        /* check the period */
+        if (period_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* start telemetry */
+        if (a_telemetry_start(period) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            tea5767_interface_debug_print("tea5767: telemetry period is %dms.\n", period);
+            
+            return 0;
+        }
+    }
+    else if (strcmp("e_save", type) == 0)
+    {
+        /* check the preset */
+        if (preset_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* map the store */
+        if (a_preset_map() != 0)
+        {
+            return 1;
+        }
+        
+        /* save */
+        if (tea5767_basic_preset_save(gs_preset, preset) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            (void)msync(gs_preset, sizeof(tea5767_preset_store_t), MS_ASYNC);
+            tea5767_interface_debug_print("tea5767: save preset %d pll 0x%04X level 0x%02X.\n", 
+                                          preset, gs_preset->record[preset].pll, gs_preset->record[preset].level);
+            
+            return 0;
+        }
+    }
+    else if (strcmp("e_recall", type) == 0)
+    {
+        /* check the preset */
+        if (preset_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* map the store */
+        if (a_preset_map() != 0)
+        {
+            return 1;
+        }
+        
+        /* recall */
+        if (tea5767_basic_preset_recall(gs_preset, preset) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            tea5767_interface_debug_print("tea5767: recall preset %d pll 0x%04X.\n", preset, gs_preset->record[preset].pll);
+            
+            return 0;
+        }
+    }
+    else if (strcmp("e_trace", type) == 0)
+    {
+        /* save the trace and stop tracing */
+        if (file != NULL)
+        {
+            if (gs_trace.record == NULL)
+            {
+                tea5767_interface_debug_print("tea5767: trace is not started.\n");
+                
+                return 1;
+            }
+            (void)tea5767_basic_trace(NULL);
+            
+            return a_trace_save(file);
+        }
+        
+        /* start tracing */
+        if (tea5767_trace_init(&gs_trace, gs_trace_record, SERVER_TRACE_SIZE, a_clock_us) != 0)
+        {
+            return 1;
+        }
+        (void)tea5767_basic_trace(&gs_trace);
+        tea5767_interface_debug_print("tea5767: trace %d transfers.\n", SERVER_TRACE_SIZE);
+        
+        return 0;
+    }
+    else if (strcmp("s_stats", type) == 0)
+    {
+        /* check the stats */
+        if (gs_stats.clock_us == NULL)
+        {
+            tea5767_interface_debug_print("tea5767: stats run in the server only.\n");
+            
+            return 1;
+        }
+        
+        /* print the stats */
+        return a_stats_print();
+    }
+    else if (strcmp("s_reset", type) == 0)
+    {
+        /* check the stats */
+        if (gs_stats.clock_us == NULL)
+        {
+            tea5767_interface_debug_print("tea5767: stats run in the server only.\n");
+            
+            return 1;
+        }
+        
+        /* reset the stats */
+        if (tea5767_stats_reset(&gs_stats) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            tea5767_interface_debug_print("tea5767: reset the stats.\n");
+            
+            return 0;
+        }
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -373,6 +1130,16 @@ uint8_t tea5767(uint8_t argc, char **argv)
         tea5767_interface_debug_print("  tea5767 (-p | --port)\n");
         tea5767_interface_debug_print("  tea5767 (-t reg | --test=reg)\n");
         tea5767_interface_debug_print("  tea5767 (-t radio | --test=radio) [--crystal=<13MHz | 6.5MHz | 32.768KHz>]\n");
+        tea5767_interface_debug_print("  tea5767 (-t replay | --test=replay) [--file=<path>]\n");
+        tea5767_interface_debug_print("  tea5767 (-t telemetry | --test=telemetry)\n");
+        tea5767_interface_debug_print("  tea5767 (-t afc | --test=afc)\n");
+        tea5767_interface_debug_print("  tea5767 (-t tune | --test=tune)\n");
+        tea5767_interface_debug_print("  tea5767 (-t preset | --test=preset)\n");
+        tea5767_interface_debug_print("  tea5767 (-t stats | --test=stats)\n");
+        tea5767_interface_debug_print("  tea5767 (-t sched | --test=sched)\n");
+        tea5767_interface_debug_print("  tea5767 (-b convert | --benchmark=convert)\n");
+        tea5767_interface_debug_print("  tea5767 (-b accessor | --benchmark=accessor)\n");
+        tea5767_interface_debug_print("  tea5767 (-b pool | --benchmark=pool)\n");
         tea5767_interface_debug_print("  tea5767 (-e init | --example=init)\n");
         tea5767_interface_debug_print("  tea5767 (-e deinit | --example=deinit)\n");
         tea5767_interface_debug_print("  tea5767 (-e up | --example=up)\n");
@@ -381,18 +1148,33 @@ uint8_t tea5767(uint8_t argc, char **argv)
         tea5767_interface_debug_print("  tea5767 (-e no-mute | --example=no-mute)\n");
         tea5767_interface_debug_print("  tea5767 (-e set | --example=set) --freq=<MHz>\n");
         tea5767_interface_debug_print("  tea5767 (-e get | --example=get)\n");
+        tea5767_interface_debug_print("  tea5767 (-e telemetry | --example=telemetry) --period=<ms>\n");
+        tea5767_interface_debug_print("  tea5767 (-e save | --example=save) --preset=<index>\n");
+        tea5767_interface_debug_print("  tea5767 (-e recall | --example=recall) --preset=<index>\n");
+        tea5767_interface_debug_print("  tea5767 (-e trace | --example=trace) [--file=<path>]\n");
+        tea5767_interface_debug_print("  tea5767 (-s stats | --stats=stats)\n");
+        tea5767_interface_debug_print("  tea5767 (-s reset | --stats=reset)\n");
         tea5767_interface_debug_print("\n");
         tea5767_interface_debug_print("Options:\n");
+        tea5767_interface_debug_print("  -b <convert | accessor | pool>, --benchmark=<convert | accessor | pool>\n");
+        tea5767_interface_debug_print("                          Run the host benchmark, pool needs the simulator build.\n");
         tea5767_interface_debug_print("      --crystal=<13MHz | 6.5MHz | 32.768KHz>\n");
         tea5767_interface_debug_print("                          Set the crystal frequence.([default: 32.768KHz])\n");
-        tea5767_interface_debug_print("  -e <init | deinit | up | down | mute | no-mute | set | get>, --example=<init\n");
-        tea5767_interface_debug_print("     | deinit | up | down | mute | no-mute | set | get>\n");
+        tea5767_interface_debug_print("  -e <init | deinit | up | down | mute | no-mute | set | get | telemetry | save | recall | trace>,\n");
+        tea5767_interface_debug_print("     --example=<init | deinit | up | down | mute | no-mute | set | get | telemetry | save | recall | trace>\n");
         tea5767_interface_debug_print("                          Run the driver example.\n");
+        tea5767_interface_debug_print("      --file=<path>       Set the trace file, trace saves the captured transfers and stops tracing,\n");
+        tea5767_interface_debug_print("                          replay feeds the saved transfers back through the driver.\n");
         tea5767_interface_debug_print("      --freq=<MHz>        Set the frequence in MHz.\n");
+        tea5767_interface_debug_print("      --period=<ms>       Set the telemetry sample period in ms, 0 stops sampling.\n");
+        tea5767_interface_debug_print("      --preset=<index>    Set the preset index.([0 - 15])\n");
         tea5767_interface_debug_print("  -h, --help              Show the help.\n");
         tea5767_interface_debug_print("  -i, --information       Show the chip information.\n");
         tea5767_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
-        tea5767_interface_debug_print("  -t <reg | radio>, --test=<reg | radio>\n");
+        tea5767_interface_debug_print("  -s <stats | reset>, --stats=<stats | reset>\n");
+        tea5767_interface_debug_print("                          Show or reset the operation counters and latency histograms of the server.\n");
+        tea5767_interface_debug_print("  -t <reg | radio | replay | telemetry | afc | tune | preset | stats | sched>,\n");
+        tea5767_interface_debug_print("     --test=<reg | radio | replay | telemetry | afc | tune | preset | stats | sched>\n");
         tea5767_interface_debug_print("                          Run the driver test.\n");
         
         return 0;
@@ -429,19 +1211,119 @@ uint8_t tea5767(uint8_t argc, char **argv)
     }
 }
 
+/**
+ * @brief     print the shell status
+ * @param[in] res shell status code
+ * @note      none
+ */
+static void a_shell_status_print(uint8_t res)
+{
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        tea5767_interface_debug_print("tea5767: run failed.\n");
+    }
+    else if (res == 2)
+    {
+        tea5767_interface_debug_print("tea5767: unknown command.\n");
+    }
+    else if (res == 3)
+    {
+        tea5767_interface_debug_print("tea5767: length is too long.\n");
+    }
+    else if (res == 4)
+    {
+        tea5767_interface_debug_print("tea5767: pretreat failed.\n");
+    }
+    else if (res == 5)
+    {
+        tea5767_interface_debug_print("tea5767: param is invalid.\n");
+    }
+    else
+    {
+        tea5767_interface_debug_print("tea5767: unknown status code.\n");
+    }
+}
+
+/**
+ * @brief  local socket init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   every message of the seqpacket socket is one command,
+ *         a message carrying a memfd and an eventfd attaches a shared memory ring
+ */
+static uint8_t a_unix_init(void)
+{
+    struct sockaddr_un addr;
+    struct epoll_event ev;
+    
+    /* creat a socket */
+    gs_unix_fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0);
+    if (gs_unix_fd < 0) 
+    {
+        tea5767_interface_debug_print("tea5767: create local socket failed.\n");
+        
+        return 1;
+    }
+    
+    /* bind the path */
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, SERVER_UNIX_PATH, sizeof(addr.sun_path) - 1);
+    (void)unlink(SERVER_UNIX_PATH);
+    if (bind(gs_unix_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) 
+    {
+        tea5767_interface_debug_print("tea5767: bind local socket failed.\n");
+        (void)close(gs_unix_fd);
+        
+        return 1;
+    }
+    
+    /* listen the path */
+    if (listen(gs_unix_fd, 10) < 0) 
+    {
+        tea5767_interface_debug_print("tea5767: listen local socket failed.\n");
+        (void)close(gs_unix_fd);
+        (void)unlink(SERVER_UNIX_PATH);
+        
+        return 1;
+    }
+    
+    /* watch the listen socket */
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u32 = SERVER_UNIX_LISTEN;
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, gs_unix_fd, &ev) < 0)
+    {
+        tea5767_interface_debug_print("tea5767: epoll add failed.\n");
+        (void)close(gs_unix_fd);
+        (void)unlink(SERVER_UNIX_PATH);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  socket init
  * @return status code
  *         - 0 success
  *         - 1 init failed
- * @note   none
+ * @note   the listen socket is non-blocking and watched by epoll
  */
 static uint8_t a_socket_init(void)
 {
     int optval;
+    int i;
+    struct epoll_event ev;
     
     /* creat a socket */
-    gs_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    gs_listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
     if (gs_listen_fd < 0) 
     {
         tea5767_interface_debug_print("tea5767: create socket failed.\n");
@@ -483,39 +1365,590 @@ static uint8_t a_socket_init(void)
         return 1;
     } 
     
-    return 0;
+    /* creat the epoll */
+    gs_epoll_fd = epoll_create1(0);
+    if (gs_epoll_fd < 0)
+    {
+        tea5767_interface_debug_print("tea5767: create epoll failed.\n");
+        (void)close(gs_listen_fd);
+        
+        return 1;
+    }
+    
+    /* watch the listen socket */
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u32 = SERVER_TCP_LISTEN;
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, gs_listen_fd, &ev) < 0)
+    {
+        tea5767_interface_debug_print("tea5767: epoll add failed.\n");
+        (void)close(gs_epoll_fd);
+        (void)close(gs_listen_fd);
+        
+        return 1;
+    }
+    
+    /* local socket init */
+    if (a_unix_init() != 0)
+    {
+        (void)close(gs_epoll_fd);
+        (void)close(gs_listen_fd);
+        
+        return 1;
+    }
+    
+    /* free all connections */
+    for (i = 0; i < SERVER_MAX_CONN; i++)
+    {
+        gs_conn[i].fd = -1;
+        gs_conn[i].ring.channel = NULL;
+    }
+    
+    return 0;
 }
 
 /**
- * @brief     socket read
- * @param[in] *buf pointer to a buffer address
- * @param[in] len buffer length
+ * @brief     close a connection
+ * @param[in] *conn pointer to a connection
+ * @note      none
+ */
+static void a_conn_close(server_conn_t *conn)
+{
+    if (conn->ring.channel != NULL)
+    {
+        (void)epoll_ctl(gs_epoll_fd, EPOLL_CTL_DEL, conn->ring.event_fd, NULL);
+        ring_close(&conn->ring);
+    }
+    (void)epoll_ctl(gs_epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+    (void)close(conn->fd);
+    conn->fd = -1;
+}
+
+/**
+ * @brief     update the watched events of a connection
+ * @param[in] *conn pointer to a connection
+ * @note      reading pauses while the command or the response buffer is full,
+ *            a closing connection is closed once its responses are sent
+ */
+static void a_conn_update(server_conn_t *conn)
+{
+    uint32_t events;
+    struct epoll_event ev;
+    
+    /* close when all responses are sent */
+    if ((conn->closing != 0) && (conn->out_len == 0))
+    {
+        a_conn_close(conn);
+        
+        return;
+    }
+    
+    /* get the events */
+    events = 0;
+    if ((conn->closing == 0) && (conn->in_len < SERVER_IN_LEN) && 
+        (conn->out_len + SERVER_RESPONSE_LEN <= SERVER_OUT_LEN))
+    {
+        events |= EPOLLIN;
+    }
+    if (conn->out_len != 0)
+    {
+        events |= EPOLLOUT;
+    }
+    
+    /* update only when changed */
+    if (events != conn->events)
+    {
+        memset(&ev, 0, sizeof(ev));
+        ev.events = events;
+        ev.data.u32 = (uint32_t)(conn - gs_conn);
+        (void)epoll_ctl(gs_epoll_fd, EPOLL_CTL_MOD, conn->fd, &ev);
+        conn->events = events;
+    }
+}
+
+/**
+ * @brief     accept the pending connections
+ * @param[in] listen_fd listen socket handle
+ * @param[in] packet local seqpacket socket flag
+ * @note      a connection is refused when all slots are used
+ */
+static void a_conn_accept(int listen_fd, uint8_t packet)
+{
+    int fd;
+    int i;
+    struct epoll_event ev;
+    
+    while (1)
+    {
+        /* accept a connection */
+        fd = accept(listen_fd, (struct sockaddr *)NULL, NULL);
+        if (fd < 0)
+        {
+            return;
+        }
+        (void)fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        
+        /* find a free slot */
+        for (i = 0; i < SERVER_MAX_CONN; i++)
+        {
+            if (gs_conn[i].fd < 0)
+            {
+                break;
+            }
+        }
+        if (i == SERVER_MAX_CONN)
+        {
+            tea5767_interface_debug_print("tea5767: too many connections.\n");
+            (void)close(fd);
+            
+            continue;
+        }
+        
+        /* watch the connection */
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.u32 = (uint32_t)i;
+        if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+        {
+            (void)close(fd);
+            
+            continue;
+        }
+        gs_conn[i].fd = fd;
+        gs_conn[i].events = EPOLLIN;
+        gs_conn[i].in_len = 0;
+        gs_conn[i].out_len = 0;
+        gs_conn[i].discard = 0;
+        gs_conn[i].packet = packet;
+        gs_conn[i].closing = 0;
+    }
+}
+
+/**
+ * @brief     send the pending responses
+ * @param[in] *conn pointer to a connection
  * @return    status code
- *             - 0 success
- *             - 1 read failed
+ *            - 0 success
+ *            - 1 connection is broken
+ * @note      a seqpacket connection gets one message per response
+ */
+static uint8_t a_conn_flush(server_conn_t *conn)
+{
+    char *end;
+    size_t len;
+    ssize_t n;
+    
+    while (conn->out_len != 0)
+    {
+        len = conn->out_len;
+        if ((conn->packet != 0) && ((uint8_t)conn->out[0] == BINARY_MAGIC))
+        {
+            len = BINARY_FRAME_LEN;
+        }
+        else if (conn->packet != 0)
+        {
+            end = memchr(conn->out, '\n', conn->out_len);
+            len = (size_t)(end - conn->out + 1);
+        }
+        n = send(conn->fd, conn->out, len, MSG_NOSIGNAL);
+        if (n < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                break;
+            }
+            
+            return 1;
+        }
+        memmove(conn->out, conn->out + n, conn->out_len - n);
+        conn->out_len -= (uint16_t)n;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run one command
+ * @param[in] *cmd pointer to a command
+ * @param[in] len command length
+ * @return    shell status code
  * @note      none
  */
-static uint16_t a_socket_read(uint8_t *buf, uint16_t len)
+static uint8_t a_shell_run(char *cmd, uint16_t len)
 {
-    int n;
+    uint8_t res;
     
-    /* wait data */
-    gs_conn_fd = accept(gs_listen_fd, (struct sockaddr *)NULL, NULL);
-    if (gs_conn_fd < 0) 
+    /* run shell */
+    memset(g_buf, 0, 256);
+    memcpy(g_buf, cmd, len);
+    g_len = len;
+    res = shell_parse((char *)g_buf, g_len);
+    a_shell_status_print(res);
+    
+    return res;
+}
+
+/**
+ * @brief     queue a response
+ * @param[in] *conn pointer to a connection
+ * @param[in] res status code
+ * @note      the response is the status code and a newline
+ */
+static void a_conn_reply(server_conn_t *conn, uint8_t res)
+{
+    conn->out_len += (uint16_t)snprintf(conn->out + conn->out_len, SERVER_OUT_LEN - conn->out_len, "%d\n", res);
+}
+
+/**
+ * @brief     run one command and queue its response
+ * @param[in] *conn pointer to a connection
+ * @param[in] *cmd pointer to a command
+ * @param[in] len command length
+ * @param[in] res pretreat status, 0 means run the command
+ * @note      the response is the shell status code and a newline
+ */
+static void a_conn_run(server_conn_t *conn, char *cmd, uint16_t len, uint8_t res)
+{
+    /* run shell */
+    if (res == 0)
     {
-        tea5767_interface_debug_print("tea5767: accept failed.\n");
-        (void)close(gs_conn_fd);
+        res = a_shell_run(cmd, len);
+    }
+    
+    /* queue the response */
+    a_conn_reply(conn, res);
+}
 
-        return 1;
+/**
+ * @brief     run the complete commands of a connection
+ * @param[in] *conn pointer to a connection
+ * @note      text commands are newline terminated, binary frames start with BINARY_MAGIC,
+ *            all are answered in order and parsing stops while the response buffer is full
+ */
+static void a_conn_parse(server_conn_t *conn)
+{
+    char *end;
+    uint16_t len;
+    uint16_t used;
+    
+    used = 0;
+    while (conn->out_len + SERVER_RESPONSE_LEN <= SERVER_OUT_LEN)
+    {
+        /* binary command */
+        if ((conn->discard == 0) && (used < conn->in_len) && ((uint8_t)conn->in[used] == BINARY_MAGIC))
+        {
+            if (conn->in_len - used < BINARY_FRAME_LEN)
+            {
+                break;
+            }
+            (void)binary_run((uint8_t *)conn->in + used, (uint8_t *)conn->out + conn->out_len);
+            conn->out_len += BINARY_FRAME_LEN;
+            used += BINARY_FRAME_LEN;
+            
+            continue;
+        }
+        
+        /* find the next command */
+        end = memchr(conn->in + used, '\n', conn->in_len - used);
+        if (end == NULL)
+        {
+            break;
+        }
+        len = (uint16_t)(end - (conn->in + used));
+        if (conn->discard != 0)
+        {
+            /* end of an overlong command */
+            conn->discard = 0;
+            a_conn_run(conn, NULL, 0, 3);
+        }
+        else
+        {
+            /* strip the carriage return */
+            if ((len != 0) && (conn->in[used + len - 1] == '\r'))
+            {
+                len--;
+            }
+            if (len != 0)
+            {
+                a_conn_run(conn, conn->in + used, len, 0);
+            }
+        }
+        used = (uint16_t)(end - conn->in + 1);
     }
     
+    /* keep the rest */
+    memmove(conn->in, conn->in + used, conn->in_len - used);
+    conn->in_len -= used;
+    
+    /* drop an overlong command */
+    if ((conn->in_len == SERVER_IN_LEN) && (memchr(conn->in, '\n', conn->in_len) == NULL))
+    {
+        conn->in_len = 0;
+        conn->discard = 1;
+    }
+}
+
+/**
+ * @brief     handle the events of a connection
+ * @param[in] *conn pointer to a connection
+ * @param[in] events epoll events
+ * @note      a command without newline is run when the peer closes its side,
+ *            so one-shot clients still work
+ */
+static void a_conn_event(server_conn_t *conn, uint32_t events)
+{
+    ssize_t n;
+    
     /* read data */
-    n = recv(gs_conn_fd, buf, len, 0);
+    if ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0)
+    {
+        while (conn->in_len < SERVER_IN_LEN)
+        {
+            n = recv(conn->fd, conn->in + conn->in_len, SERVER_IN_LEN - conn->in_len, 0);
+            if (n > 0)
+            {
+                conn->in_len += (uint16_t)n;
+                a_conn_parse(conn);
+                if (conn->out_len + SERVER_RESPONSE_LEN > SERVER_OUT_LEN)
+                {
+                    break;
+                }
+                
+                continue;
+            }
+            if ((n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+            {
+                break;
+            }
+            
+            /* peer closed, run the last command */
+            if ((n == 0) && (conn->in_len != 0) && (conn->discard == 0) && 
+                ((uint8_t)conn->in[0] != BINARY_MAGIC) && (conn->out_len + SERVER_RESPONSE_LEN <= SERVER_OUT_LEN))
+            {
+                a_conn_run(conn, conn->in, conn->in_len, 0);
+            }
+            conn->in_len = 0;
+            conn->closing = 1;
+            
+            break;
+        }
+    }
+    
+    /* send the responses */
+    if (a_conn_flush(conn) != 0)
+    {
+        a_conn_close(conn);
+        
+        return;
+    }
+    
+    /* resume the paused commands */
+    a_conn_parse(conn);
+    if (a_conn_flush(conn) != 0)
+    {
+        a_conn_close(conn);
+        
+        return;
+    }
+    a_conn_update(conn);
+}
+
+/**
+ * @brief     attach the shared memory ring of a local connection
+ * @param[in] *conn pointer to a connection
+ * @param[in] *cmsg pointer to the received rights
+ * @note      the message carries the memfd of the ring and the eventfd of the doorbell,
+ *            the response is 0 when the ring is attached
+ */
+static void a_conn_attach(server_conn_t *conn, struct cmsghdr *cmsg)
+{
+    int fds[2];
+    int fd;
+    size_t num;
+    size_t i;
+    struct epoll_event ev;
+    
+    /* get the handles */
+    num = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    if ((num != 2) || (conn->ring.channel != NULL))
+    {
+        for (i = 0; i < num; i++)
+        {
+            memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+            (void)close(fd);
+        }
+        a_conn_reply(conn, 1);
+        
+        return;
+    }
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
     
-    /* close the socket */
-    (void)close(gs_conn_fd);
+    /* map the ring */
+    if (ring_attach(&conn->ring, fds[0], fds[1]) != 0)
+    {
+        tea5767_interface_debug_print("tea5767: attach ring failed.\n");
+        a_conn_reply(conn, 1);
+        
+        return;
+    }
     
-    return n;
+    /* watch the doorbell */
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u32 = SERVER_RING_EVENT + (uint32_t)(conn - gs_conn);
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, conn->ring.event_fd, &ev) < 0)
+    {
+        ring_close(&conn->ring);
+        a_conn_reply(conn, 1);
+        
+        return;
+    }
+    a_conn_reply(conn, 0);
+}
+
+/**
+ * @brief     handle the events of a local connection
+ * @param[in] *conn pointer to a connection
+ * @param[in] events epoll events
+ * @note      every message is one command, so no framing is needed
+ */
+static void a_conn_packet(server_conn_t *conn, uint32_t events)
+{
+    char control[CMSG_SPACE(2 * sizeof(int))];
+    struct msghdr msg;
+    struct iovec iov;
+    struct cmsghdr *cmsg;
+    ssize_t n;
+    
+    /* read messages */
+    while (((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0) && 
+           (conn->out_len + SERVER_RESPONSE_LEN <= SERVER_OUT_LEN))
+    {
+        /* receive one message */
+        memset(&msg, 0, sizeof(msg));
+        iov.iov_base = conn->in;
+        iov.iov_len = SERVER_IN_LEN - 1;
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        n = recvmsg(conn->fd, &msg, MSG_CMSG_CLOEXEC);
+        if ((n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+        {
+            break;
+        }
+        if (n <= 0)
+        {
+            /* peer closed */
+            conn->closing = 1;
+            
+            break;
+        }
+        
+        /* attach a ring */
+        cmsg = CMSG_FIRSTHDR(&msg);
+        if ((cmsg != NULL) && (cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_RIGHTS))
+        {
+            a_conn_attach(conn, cmsg);
+            
+            continue;
+        }
+        
+        /* run the command */
+        if ((msg.msg_flags & MSG_TRUNC) != 0)
+        {
+            a_conn_reply(conn, 3);
+            
+            continue;
+        }
+        if ((n == BINARY_FRAME_LEN) && ((uint8_t)conn->in[0] == BINARY_MAGIC))
+        {
+            (void)binary_run((uint8_t *)conn->in, (uint8_t *)conn->out + conn->out_len);
+            conn->out_len += BINARY_FRAME_LEN;
+            
+            continue;
+        }
+        while ((n != 0) && ((conn->in[n - 1] == '\n') || (conn->in[n - 1] == '\r')))
+        {
+            n--;
+        }
+        if (n == 0)
+        {
+            a_conn_reply(conn, 2);
+            
+            continue;
+        }
+        a_conn_run(conn, conn->in, (uint16_t)n, 0);
+    }
+    
+    /* send the responses */
+    if (a_conn_flush(conn) != 0)
+    {
+        a_conn_close(conn);
+        
+        return;
+    }
+    a_conn_update(conn);
+}
+
+/**
+ * @brief  run the pending commands of all rings
+ * @return number of run commands
+ * @note   a status is dropped when the client doesn't drain its status ring
+ */
+static uint32_t a_ring_poll(void)
+{
+    char cmd[RING_COMMAND_LEN];
+    uint16_t len;
+    uint32_t cnt;
+    uint32_t num;
+    int i;
+    
+    cnt = 0;
+    for (i = 0; i < SERVER_MAX_CONN; i++)
+    {
+        if ((gs_conn[i].fd < 0) || (gs_conn[i].ring.channel == NULL))
+        {
+            continue;
+        }
+        
+        /* at most one ring of commands per client for fairness */
+        for (num = 0; num < RING_SLOT_NUM; num++)
+        {
+            if (ring_pop_command(&gs_conn[i].ring, cmd, &len) != 0)
+            {
+                break;
+            }
+            (void)ring_push_status(&gs_conn[i].ring, a_shell_run(cmd, len));
+        }
+        cnt += num;
+    }
+    
+    return cnt;
+}
+
+/**
+ * @brief  arm the doorbells of all rings
+ * @return status code
+ *         - 0 server can sleep
+ *         - 1 commands are pending
+ * @note   none
+ */
+static uint8_t a_ring_sleep(void)
+{
+    uint8_t res;
+    int i;
+    
+    res = 0;
+    for (i = 0; i < SERVER_MAX_CONN; i++)
+    {
+        if ((gs_conn[i].fd >= 0) && (gs_conn[i].ring.channel != NULL))
+        {
+            res |= ring_sleep(&gs_conn[i].ring);
+        }
+    }
+    
+    return res;
 }
 
 /**
@@ -529,6 +1962,8 @@ static void a_sig_handler(int signum)
     {
         tea5767_interface_debug_print("tea5767: close the server.\n");
         (void)close(gs_listen_fd);
+        (void)close(gs_unix_fd);
+        (void)unlink(SERVER_UNIX_PATH);
         exit(0);
     }
     
@@ -536,12 +1971,71 @@ static void a_sig_handler(int signum)
 }
 
 /**
- * @brief main function
- * @note  none
+ * @brief     run one command from the program arguments
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    shell status code
+ * @note      the command is prefixed with "tea5767"
+ */
+static uint8_t a_run_once(int argc, char **argv)
+{
+    uint8_t res;
+    int i;
+    
+    /* cat the full command */
+    memset(g_buf, 0, 256);
+    strncat((char *)g_buf, "tea5767", 255);
+    for (i = 1; i < argc; i++)
+    {
+        strncat((char *)g_buf, " ", 255 - strlen((char *)g_buf));
+        strncat((char *)g_buf, argv[i], 255 - strlen((char *)g_buf));
+    }
+    g_len = (uint16_t)strlen((char *)g_buf);
+    
+    /* run shell */
+    res = shell_parse((char *)g_buf, g_len);
+    a_shell_status_print(res);
+    
+#ifdef TEA5767_SIMULATOR
+    {
+        tea5767_simulator_stats_t stats;
+        
+        /* print the simulated timing */
+        (void)tea5767_simulator_get_stats(tea5767_simulator_get_default(), &stats);
+        tea5767_interface_debug_print("tea5767: simulated time is %llu us.\n", (unsigned long long)stats.time_us);
+        tea5767_interface_debug_print("tea5767: simulated bus time is %llu us.\n", (unsigned long long)stats.bus_us);
+        tea5767_interface_debug_print("tea5767: %u writes (%u bytes), %u reads (%u bytes).\n",
+                                      (unsigned int)stats.write_count, (unsigned int)stats.write_bytes,
+                                      (unsigned int)stats.read_count, (unsigned int)stats.read_bytes);
+    }
+#endif
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      with arguments, runs one command and exits instead of serving
  */
-int main(void)
+int main(int argc, char **argv)
 {
     uint8_t res;
+    uint64_t spin_us;
+    
+    /* shell init && register tea5767 function */
+    shell_init();
+    shell_register("tea5767", tea5767);
+    
+    /* run once */
+    if (argc > 1)
+    {
+        return (a_run_once(argc, argv) == 0) ? 0 : 1;
+    }
     
     /* socket init */
     res = a_socket_init();
@@ -552,49 +2046,87 @@ int main(void)
         return 1;
     }
     
-    /* shell init && register tea5767 function */
-    shell_init();
-    shell_register("tea5767", tea5767);
+    /* telemetry init */
+    res = a_telemetry_init();
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: telemetry init failed.\n");
+        
+        return 1;
+    }
+    
+    /* stats init */
+    res = tea5767_stats_init(&gs_stats, a_clock_us);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: stats init failed.\n");
+        
+        return 1;
+    }
     tea5767_interface_debug_print("tea5767: welcome to libdriver tea5767.\n");
     
     /* set the signal */
     signal(SIGINT, a_sig_handler);
     
+    spin_us = 0;
     while (1)
     {
-        /* read uart */
-        g_len = a_socket_read(g_buf, 256);
-        if (g_len != 0)
+        struct epoll_event events[SERVER_MAX_EVENT];
+        uint32_t tag;
+        int timeout;
+        int n;
+        int i;
+        
+        /* busy poll the rings for a while after a command, then sleep on the doorbells */
+        if (a_ring_poll() != 0)
         {
-            /* run shell */
-            res = shell_parse((char *)g_buf, g_len);
-            if (res == 0)
-            {
-                /* run success */
-            }
-            else if (res == 1)
+            spin_us = a_time_us() + SERVER_RING_SPIN_US;
+        }
+        timeout = -1;
+        if ((a_time_us() < spin_us) || (a_ring_sleep() != 0))
+        {
+            /* let the clients run on the same core */
+            (void)sched_yield();
+            timeout = 0;
+        }
+        
+        /* wait the events */
+        n = epoll_wait(gs_epoll_fd, events, SERVER_MAX_EVENT, timeout);
+        for (i = 0; i < n; i++)
+        {
+            tag = events[i].data.u32;
+            if (tag == SERVER_TCP_LISTEN)
             {
-                tea5767_interface_debug_print("tea5767: run failed.\n");
+                /* new connections */
+                a_conn_accept(gs_listen_fd, 0);
             }
-            else if (res == 2)
+            else if (tag == SERVER_TELEMETRY_EVENT)
             {
-                tea5767_interface_debug_print("tea5767: unknown command.\n");
+                /* telemetry sample */
+                a_telemetry_event();
             }
-            else if (res == 3)
+            else if (tag == SERVER_UNIX_LISTEN)
             {
-                tea5767_interface_debug_print("tea5767: length is too long.\n");
+                /* new local connections */
+                a_conn_accept(gs_unix_fd, 1);
             }
-            else if (res == 4)
+            else if (tag >= SERVER_RING_EVENT)
             {
-                tea5767_interface_debug_print("tea5767: pretreat failed.\n");
+                /* ring doorbell, the commands are run by the next poll */
+                if (gs_conn[tag - SERVER_RING_EVENT].ring.channel != NULL)
+                {
+                    ring_wake(&gs_conn[tag - SERVER_RING_EVENT].ring);
+                }
             }
-            else if (res == 5)
+            else if ((gs_conn[tag].fd >= 0) && (gs_conn[tag].packet != 0))
             {
-                tea5767_interface_debug_print("tea5767: param is invalid.\n");
+                /* local client commands */
+                a_conn_packet(&gs_conn[tag], events[i].events);
             }
-            else
+            else if (gs_conn[tag].fd >= 0)
             {
-                tea5767_interface_debug_print("tea5767: unknown status code.\n");
+                /* client commands */
+                a_conn_event(&gs_conn[tag], events[i].events);
             }
         }
     }
@@ -53,6 +53,230 @@
  */
 #define TEA5767_ADDRESS             0xC0        /**< iic device address */
 
+/**
+ * @brief search timing definition
+ */
+#define TEA5767_SEARCH_SETTLE_MS           10          /**< pll settling time before the first poll */
+#define TEA5767_SEARCH_MIN_INTERVAL_MS     4           /**< min poll interval */
+#define TEA5767_SEARCH_MAX_INTERVAL_MS     100         /**< max poll interval */
+#define TEA5767_SEARCH_TIMEOUT_MS          3000        /**< search timeout */
+
+/**
+ * @brief scan definition
+ */
+#define TEA5767_SCAN_RASTER_KHZ            100         /**< channel raster */
+#define TEA5767_SCAN_IF_MIN                0x31        /**< min if counter of a tuned station */
+#define TEA5767_SCAN_IF_MAX                0x3E        /**< max if counter of a tuned station */
+#define TEA5767_SCAN_PHASE_SEARCH          0x00        /**< scan is waiting for a hardware search */
+#define TEA5767_SCAN_PHASE_TUNE            0x01        /**< scan is waiting for a tuned channel */
+#define TEA5767_US_EUROPE_MIN_KHZ          87500       /**< US/Europe band min */
+#define TEA5767_US_EUROPE_MAX_KHZ          108000      /**< US/Europe band max */
+#define TEA5767_JAPANESE_MIN_KHZ           76000       /**< Japanese band min */
+#define TEA5767_JAPANESE_MAX_KHZ           91000       /**< Japanese band max */
+
+/**
+ * @brief afc definition
+ */
+#define TEA5767_AFC_IF_CENTER              0x37        /**< if counter at 225KHz */
+#define TEA5767_AFC_IF_STEP_HZ             4096        /**< if counter resolution */
+#define TEA5767_AFC_IF_RANGE               0x19        /**< max if offset of a captured carrier, about 100KHz */
+#define TEA5767_AFC_MAX_STEP               3           /**< max pll corrections */
+
+/**
+ * @brief if definition
+ */
+#define TEA5767_IF_KHZ                     225         /**< intermediate frequency */
+
+/**
+ * @brief pll ratio table definition, pll = (khz +/- if) * num / den
+ */
+static const uint16_t gsc_pll_ratio[3][2] =
+{
+    {1, 3250},          /**< 13MHz, 4 / 13000 */
+    {125, 1024},        /**< 32.768KHz, 4 / 32.768 */
+    {1, 1625},          /**< 6.5MHz, 4 / 6500 */
+};
+
+/**
+ * @brief      convert a pll to the tuned frequency
+ * @param[in]  clk chip clock index
+ * @param[in]  side 1 means high side lo injection
+ * @param[in]  pll pll value
+ * @param[out] *khz pointer to a frequency buffer, 0 if out of range
+ * @return     1 if the frequency is valid, 0 if the lo is below the if
+ * @note       branch free, the lo is rounded up so tea5767_khz_to_pll maps back to the same pll
+ */
+static uint32_t a_tea5767_pll_to_khz(uint8_t clk, uint32_t side, uint16_t pll, uint32_t *khz)
+{
+    uint32_t lo;
+    uint32_t valid;
+    
+    lo = ((uint32_t)pll * gsc_pll_ratio[clk][1] + gsc_pll_ratio[clk][0] - 1) 
+         / gsc_pll_ratio[clk][0];                                         /* convert raw data to real data */
+    valid = (uint32_t)(lo >= side * TEA5767_IF_KHZ);                      /* high side lo must be above the if */
+    *khz = (lo + TEA5767_IF_KHZ - side * (2 * TEA5767_IF_KHZ))
+           & (0U - valid);                                                /* lo is below or above, 0 if out of range */
+    
+    return valid;                                                         /* return the valid flag */
+}
+
+/**
+ * @brief     get the trace start time of a transfer
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    start time in us
+ * @note      none
+ */
+static uint32_t a_tea5767_trace_start(tea5767_handle_t *handle)
+{
+#if (TEA5767_TRACE != 0)
+    if (handle->trace != NULL) /* check the trace */
+    {
+        return handle->trace->clock_us(); /* get the start time */
+    }
+#else
+    (void)handle; /* trace is compiled out */
+#endif
+    
+    return 0; /* no trace */
+}
+
+/**
+ * @brief     record a transfer in the trace ring
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] dir transfer direction
+ * @param[in] start transfer start time in us
+ * @param[in] res bus result
+ * @param[in] *wdata pointer to a write data buffer
+ * @param[in] wlen write data length
+ * @param[in] *rdata pointer to a read data buffer
+ * @param[in] rlen read data length
+ * @note      the oldest record is overwritten when the ring is full, bytes beyond the record size are not stored
+ */
+static void a_tea5767_trace_record(tea5767_handle_t *handle, uint8_t dir, uint32_t start, uint8_t res,
+                                   uint8_t *wdata, uint16_t wlen, uint8_t *rdata, uint16_t rlen)
+{
+#if (TEA5767_TRACE != 0)
+    tea5767_trace_record_t *record;
+    uint16_t wnum;
+    uint16_t rnum;
+    
+    if (handle->trace == NULL)                                                                      /* check the trace */
+    {
+        return;                                                                                     /* no trace */
+    }
+    
+    record = &handle->trace->record[handle->trace->head & (handle->trace->size - 1)];               /* get the slot */
+    record->timestamp_us = start;                                                                   /* set the start time */
+    record->latency_us = handle->trace->clock_us() - start;                                         /* set the latency */
+    record->dir = dir;                                                                              /* set the direction */
+    record->res = res;                                                                              /* set the result */
+    record->wlen = (wlen > 0xFF) ? 0xFF : (uint8_t)wlen;                                            /* set the written length */
+    record->rlen = (rlen > 0xFF) ? 0xFF : (uint8_t)rlen;                                            /* set the read length */
+    wnum = (wlen > TEA5767_TRACE_DATA_SIZE) ? TEA5767_TRACE_DATA_SIZE : wlen;                       /* stored written bytes */
+    rnum = (rlen > (TEA5767_TRACE_DATA_SIZE - wnum)) ? (TEA5767_TRACE_DATA_SIZE - wnum) : rlen;     /* stored read bytes */
+    if (wnum != 0)                                                                                  /* check the written bytes */
+    {
+        memcpy(record->data, wdata, wnum);                                                          /* copy the written bytes */
+    }
+    if (rnum != 0)                                                                                  /* check the read bytes */
+    {
+        memcpy(&record->data[wnum], rdata, rnum);                                                   /* copy the read bytes */
+    }
+    handle->trace->head++;                                                                          /* publish the record */
+#else
+    (void)handle;                                                                                   /* trace is compiled out */
+    (void)dir;                                                                                      /* trace is compiled out */
+    (void)start;                                                                                    /* trace is compiled out */
+    (void)res;                                                                                      /* trace is compiled out */
+    (void)wdata;                                                                                    /* trace is compiled out */
+    (void)wlen;                                                                                     /* trace is compiled out */
+    (void)rdata;                                                                                    /* trace is compiled out */
+    (void)rlen;                                                                                     /* trace is compiled out */
+#endif
+}
+
+/**
+ * @brief     get the stats start time of an operation
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    start time in us
+ * @note      none
+ */
+static uint32_t a_tea5767_stats_start(tea5767_handle_t *handle)
+{
+#if (TEA5767_STATS != 0)
+    if (handle->stats != NULL)                /* check the stats */
+    {
+        return handle->stats->clock_us();     /* get the start time */
+    }
+#else
+    (void)handle;                             /* stats are compiled out */
+#endif
+    
+    return 0;                                 /* no stats */
+}
+
+/**
+ * @brief     add an operation to the stats
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] op operation
+ * @param[in] us latency in us
+ * @param[in] res operation result
+ * @note      none
+ */
+static void a_tea5767_stats_add(tea5767_handle_t *handle, uint8_t op, uint32_t us, uint8_t res)
+{
+#if (TEA5767_STATS != 0)
+    tea5767_stats_counter_t *counter;
+    uint8_t b;
+    
+    if (handle->stats == NULL)                                                 /* check the stats */
+    {
+        return;                                                                /* no stats */
+    }
+    
+    counter = &handle->stats->counter[op];                                     /* get the counter */
+    counter->count++;                                                          /* count the call */
+    counter->fail += (res != 0) ? 1 : 0;                                       /* count the failure */
+    counter->total_us += us;                                                   /* add the latency */
+    counter->min_us = (us < counter->min_us) ? us : counter->min_us;           /* update the min */
+    counter->max_us = (us > counter->max_us) ? us : counter->max_us;           /* update the max */
+    b = 0;                                                                     /* init 0 */
+    while ((b < (TEA5767_STATS_BUCKET_NUM - 1)) && ((us >> (b + 1)) != 0))     /* find the log2 bucket */
+    {
+        b++;                                                                   /* next bucket */
+    }
+    counter->bucket[b]++;                                                      /* count the bucket */
+#else
+    (void)handle;                                                              /* stats are compiled out */
+    (void)op;                                                                  /* stats are compiled out */
+    (void)us;                                                                  /* stats are compiled out */
+    (void)res;                                                                 /* stats are compiled out */
+#endif
+}
+
+/**
+ * @brief     add a timed operation to the stats
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] op operation
+ * @param[in] start operation start time in us
+ * @param[in] res operation result
+ * @note      none
+ */
+static void a_tea5767_stats_stop(tea5767_handle_t *handle, uint8_t op, uint32_t start, uint8_t res)
+{
+#if (TEA5767_STATS != 0)
+    if (handle->stats != NULL)                                                       /* check the stats */
+    {
+        a_tea5767_stats_add(handle, op, handle->stats->clock_us() - start, res);     /* add the operation */
+    }
+#else
+    (void)handle;                                                                    /* stats are compiled out */
+    (void)op;                                                                        /* stats are compiled out */
+    (void)start;                                                                     /* stats are compiled out */
+    (void)res;                                                                       /* stats are compiled out */
+#endif
+}
+
 /**
  * @brief      read bytes
  * @param[in]  *handle pointer to a tea5767 handle structure
@@ -65,13 +289,29 @@
  */
 static uint8_t a_tea5767_iic_read(tea5767_handle_t *handle, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_read_cmd(TEA5767_ADDRESS, data, len) != 0)        /* read the register */
+    uint8_t res;
+    uint32_t trace_start;
+    uint32_t stats_start;
+    
+    trace_start = a_tea5767_trace_start(handle);                                                      /* get the trace start time */
+    stats_start = a_tea5767_stats_start(handle);                                                      /* get the stats start time */
+    if (handle->iic_read_ctx_cmd != NULL)                                                             /* check the ctx command */
     {
-        return 1;                                                     /* return error */
+        res = handle->iic_read_ctx_cmd(handle->bus_ctx, TEA5767_ADDRESS, data, len);                  /* read with the bus context */
+    }
+    else
+    {
+        res = handle->iic_read_cmd(TEA5767_ADDRESS, data, len);                                       /* read the register */
+    }
+    a_tea5767_stats_stop(handle, TEA5767_STATS_OP_IIC_READ, stats_start, res);                        /* count the transfer */
+    a_tea5767_trace_record(handle, TEA5767_TRACE_DIR_READ, trace_start, res, NULL, 0, data, len);     /* trace the transfer */
+    if (res != 0)                                                                                     /* check the result */
+    {
+        return 1;                                                                                     /* return error */
     }
     else
     {
-        return 0;                                                     /* success return 0 */
+        return 0;                                                                                     /* success return 0 */
     }
 }
 
@@ -87,16 +327,404 @@ static uint8_t a_tea5767_iic_read(tea5767_handle_t *handle, uint8_t *data, uint1
  */
 static uint8_t a_tea5767_iic_write(tea5767_handle_t *handle, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_write_cmd(TEA5767_ADDRESS, data, len) != 0)        /* write the register */
+    uint8_t res;
+    uint32_t trace_start;
+    uint32_t stats_start;
+    
+    trace_start = a_tea5767_trace_start(handle);                                                       /* get the trace start time */
+    stats_start = a_tea5767_stats_start(handle);                                                       /* get the stats start time */
+    if (handle->iic_write_ctx_cmd != NULL)                                                             /* check the ctx command */
+    {
+        res = handle->iic_write_ctx_cmd(handle->bus_ctx, TEA5767_ADDRESS, data, len);                  /* write with the bus context */
+    }
+    else
+    {
+        res = handle->iic_write_cmd(TEA5767_ADDRESS, data, len);                                       /* write the register */
+    }
+    a_tea5767_stats_stop(handle, TEA5767_STATS_OP_IIC_WRITE, stats_start, res);                        /* count the transfer */
+    a_tea5767_trace_record(handle, TEA5767_TRACE_DIR_WRITE, trace_start, res, data, len, NULL, 0);     /* trace the transfer */
+    if (res != 0)                                                                                      /* check the result */
+    {
+        return 1;                                                                                      /* return error */
+    }
+    else
+    {
+        return 0;                                                                                      /* success return 0 */
+    }
+}
+
+/**
+ * @brief      write bytes and read bytes
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  *wdata pointer to a write data buffer
+ * @param[in]  wlen write data length
+ * @param[out] *rdata pointer to a read data buffer
+ * @param[in]  rlen read data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       falls back to a write and a read when no write read command is linked
+ */
+static uint8_t a_tea5767_iic_write_read(tea5767_handle_t *handle, uint8_t *wdata, uint16_t wlen, 
+                                        uint8_t *rdata, uint16_t rlen)
+{
+    uint8_t res;
+    uint32_t trace_start;
+    uint32_t stats_start;
+    
+    trace_start = a_tea5767_trace_start(handle);                                             /* get the trace start time */
+    stats_start = a_tea5767_stats_start(handle);                                             /* get the stats start time */
+    if ((handle->iic_read_ctx_cmd != NULL) && (handle->iic_write_read_ctx_cmd != NULL))      /* check the ctx command */
+    {
+        res = handle->iic_write_read_ctx_cmd(handle->bus_ctx, TEA5767_ADDRESS, 
+                                             wdata, wlen, rdata, rlen);                      /* one transaction with the bus context */
+        a_tea5767_stats_stop(handle, TEA5767_STATS_OP_IIC_WRITE_READ, stats_start, res);     /* count the transaction */
+        a_tea5767_trace_record(handle, TEA5767_TRACE_DIR_WRITE_READ, trace_start, res, 
+                               wdata, wlen, rdata, rlen);                                    /* trace the transaction */
+    }
+    else if ((handle->iic_read_ctx_cmd == NULL) && (handle->iic_write_read_cmd != NULL))     /* check the command */
+    {
+        res = handle->iic_write_read_cmd(TEA5767_ADDRESS, wdata, wlen, rdata, rlen);         /* one transaction */
+        a_tea5767_stats_stop(handle, TEA5767_STATS_OP_IIC_WRITE_READ, stats_start, res);     /* count the transaction */
+        a_tea5767_trace_record(handle, TEA5767_TRACE_DIR_WRITE_READ, trace_start, res, 
+                               wdata, wlen, rdata, rlen);                                    /* trace the transaction */
+    }
+    else
     {
-        return 1;                                                      /* return error */
+        if (a_tea5767_iic_write(handle, wdata, wlen) != 0)                                   /* write the register */
+        {
+            return 1;                                                                        /* return error */
+        }
+        res = a_tea5767_iic_read(handle, rdata, rlen);                                       /* read the register */
+    }
+    if (res != 0)                                                                            /* check the result */
+    {
+        return 1;                                                                            /* return error */
     }
     else
     {
-        return 0;                                                      /* success return 0 */
+        return 0;                                                                            /* success return 0 */
+    }
+}
+
+/**
+ * @brief     write the conf prefix and update the shadow
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] len conf prefix length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_tea5767_write_conf(tea5767_handle_t *handle, uint8_t len)
+{
+    uint8_t mask;
+    
+    mask = (uint8_t)((1 << len) - 1);                                 /* get the written mask */
+    if (a_tea5767_iic_write(handle, handle->conf_up, len) != 0)       /* write conf */
+    {
+        handle->conf_dirty |= mask;                                   /* chip state is unknown */
+        
+        return 1;                                                     /* return error */
+    }
+    memcpy(handle->conf_shadow, handle->conf_up, len);                /* save the shadow */
+    handle->conf_dirty &= ~mask;                                      /* clear the dirty mask */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     get the shortest conf prefix covering the changed bytes
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] force byte mask written even when not changed
+ * @return    conf prefix length
+ * @note      none
+ */
+static uint8_t a_tea5767_conf_len(tea5767_handle_t *handle, uint8_t force)
+{
+    uint8_t i;
+    uint8_t len;
+    uint8_t mask;
+    
+    mask = handle->conf_dirty | force;                               /* get the dirty mask */
+    len = 0;                                                         /* init 0 */
+    for (i = 0; i < 5; i++)                                          /* check all bytes */
+    {
+        if ((handle->conf_up[i] != handle->conf_shadow[i]) ||        /* check the shadow */
+            (((mask >> i) & 0x01) != 0))                             /* check the mask */
+        {
+            len = i + 1;                                             /* cover this byte */
+        }
+    }
+    
+    return len;                                                      /* return the length */
+}
+
+/**
+ * @brief     write the shortest conf prefix covering the changed bytes
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] force byte mask written even when not changed
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the chip latches bytes in order, so the tail keeps the last written value
+ */
+static uint8_t a_tea5767_flush_conf(tea5767_handle_t *handle, uint8_t force)
+{
+    uint8_t len;
+    
+    len = a_tea5767_conf_len(handle, force);                         /* get the prefix length */
+    if (len == 0)                                                    /* nothing changed */
+    {
+        return 0;                                                    /* success return 0 */
+    }
+    
+    return a_tea5767_write_conf(handle, len);                        /* write the prefix */
+}
+
+/**
+ * @brief     write the shortest changed conf prefix and read the status in one transaction
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] rlen status read length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write read failed
+ * @note      the status is read into conf_down right after the write
+ */
+static uint8_t a_tea5767_flush_read_conf(tea5767_handle_t *handle, uint8_t rlen)
+{
+    uint8_t len;
+    uint8_t mask;
+    
+    len = a_tea5767_conf_len(handle, 0x00);                                               /* get the prefix length */
+    if (len == 0)                                                                         /* nothing changed */
+    {
+        return a_tea5767_iic_read(handle, handle->conf_down, rlen);                       /* read only */
+    }
+    mask = (uint8_t)((1 << len) - 1);                                                     /* get the written mask */
+    if (a_tea5767_iic_write_read(handle, handle->conf_up, len, 
+                                 handle->conf_down, rlen) != 0)                           /* write and read */
+    {
+        handle->conf_dirty |= mask;                                                       /* chip state is unknown */
+        
+        return 1;                                                                         /* return error */
+    }
+    memcpy(handle->conf_shadow, handle->conf_up, len);                                    /* save the shadow */
+    handle->conf_dirty &= ~mask;                                                          /* clear the dirty mask */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     finish an async conf transfer
+ * @param[in] *arg pointer to a tea5767 handle structure
+ * @param[in] res bus result
+ * @note      called by the link layer, e.g. from an interrupt or a worker thread,
+ *            the status is published last so a caller that sees it also sees the conf and the stats
+ */
+static void a_tea5767_async_done(void *arg, uint8_t res)
+{
+    tea5767_handle_t *handle = (tea5767_handle_t *)arg;
+    uint8_t op;
+    
+    op = handle->async_op;                                                                           /* get the operation */
+    if (op == TEA5767_ASYNC_OP_WRITE_CONF)                                                           /* write conf */
+    {
+        a_tea5767_stats_stop(handle, TEA5767_STATS_OP_WRITE_CONF, handle->async_start, res);         /* count the operation */
+        if (res != 0)                                                                                /* check the result */
+        {
+            handle->conf_dirty = 0x1F;                                                               /* chip state is unknown */
+        }
+        else
+        {
+            memcpy(handle->conf_shadow, handle->async_buf, 5);                                       /* save the written conf as the shadow */
+            handle->conf_dirty = 0;                                                                  /* clear the dirty mask */
+        }
+    }
+    else                                                                                             /* read conf */
+    {
+        a_tea5767_stats_stop(handle, TEA5767_STATS_OP_READ_CONF, handle->async_start, res);          /* count the operation */
+        if (res == 0)                                                                                /* check the result */
+        {
+            memcpy(handle->conf_down, handle->async_buf, 5);                                         /* copy the read conf */
+        }
+    }
+    TEA5767_ASYNC_BARRIER();                                                                         /* write the conf and the stats before the status */
+    handle->async_status = (res != 0) ? TEA5767_ASYNC_STATUS_FAILED : TEA5767_ASYNC_STATUS_DONE;     /* publish the result last */
+    if (handle->async_callback != NULL)                                                              /* check the async callback */
+    {
+        handle->async_callback(handle, (tea5767_async_op_t)op, res);                                 /* run the async callback */
     }
 }
 
+/**
+ * @brief channel table generator definition, pll = (khz +/- if) * num / den
+ */
+#define TEA5767_CHANNEL_ENTRY(i, b, s, n, d)  (uint16_t)((((int32_t)(b) + (int32_t)(i) * TEA5767_CHANNEL_RASTER_KHZ + (s)) * (n)) / (d)),
+#define TEA5767_CHANNEL_1(i, b, s, n, d)      TEA5767_CHANNEL_ENTRY(i, b, s, n, d)
+#define TEA5767_CHANNEL_2(i, b, s, n, d)      TEA5767_CHANNEL_1(i, b, s, n, d) TEA5767_CHANNEL_1((i) + 1, b, s, n, d)
+#define TEA5767_CHANNEL_4(i, b, s, n, d)      TEA5767_CHANNEL_2(i, b, s, n, d) TEA5767_CHANNEL_2((i) + 2, b, s, n, d)
+#define TEA5767_CHANNEL_8(i, b, s, n, d)      TEA5767_CHANNEL_4(i, b, s, n, d) TEA5767_CHANNEL_4((i) + 4, b, s, n, d)
+#define TEA5767_CHANNEL_16(i, b, s, n, d)     TEA5767_CHANNEL_8(i, b, s, n, d) TEA5767_CHANNEL_8((i) + 8, b, s, n, d)
+#define TEA5767_CHANNEL_32(i, b, s, n, d)     TEA5767_CHANNEL_16(i, b, s, n, d) TEA5767_CHANNEL_16((i) + 16, b, s, n, d)
+#define TEA5767_CHANNEL_64(i, b, s, n, d)     TEA5767_CHANNEL_32(i, b, s, n, d) TEA5767_CHANNEL_32((i) + 32, b, s, n, d)
+#define TEA5767_CHANNEL_128(i, b, s, n, d)    TEA5767_CHANNEL_64(i, b, s, n, d) TEA5767_CHANNEL_64((i) + 64, b, s, n, d)
+#define TEA5767_CHANNEL_256(i, b, s, n, d)    TEA5767_CHANNEL_128(i, b, s, n, d) TEA5767_CHANNEL_128((i) + 128, b, s, n, d)
+#if (TEA5767_CHANNEL_RASTER_KHZ == 100)
+#define TEA5767_CHANNEL_US_EUROPE(b, s, n, d) TEA5767_CHANNEL_128(0, b, s, n, d) TEA5767_CHANNEL_64(128, b, s, n, d) \
+                                              TEA5767_CHANNEL_8(192, b, s, n, d) TEA5767_CHANNEL_4(200, b, s, n, d) \
+                                              TEA5767_CHANNEL_2(204, b, s, n, d)
+#define TEA5767_CHANNEL_JAPANESE(b, s, n, d)  TEA5767_CHANNEL_128(0, b, s, n, d) TEA5767_CHANNEL_16(128, b, s, n, d) \
+                                              TEA5767_CHANNEL_4(144, b, s, n, d) TEA5767_CHANNEL_2(148, b, s, n, d) \
+                                              TEA5767_CHANNEL_1(150, b, s, n, d)
+#elif (TEA5767_CHANNEL_RASTER_KHZ == 50)
+#define TEA5767_CHANNEL_US_EUROPE(b, s, n, d) TEA5767_CHANNEL_256(0, b, s, n, d) TEA5767_CHANNEL_128(256, b, s, n, d) \
+                                              TEA5767_CHANNEL_16(384, b, s, n, d) TEA5767_CHANNEL_8(400, b, s, n, d) \
+                                              TEA5767_CHANNEL_2(408, b, s, n, d) TEA5767_CHANNEL_1(410, b, s, n, d)
+#define TEA5767_CHANNEL_JAPANESE(b, s, n, d)  TEA5767_CHANNEL_256(0, b, s, n, d) TEA5767_CHANNEL_32(256, b, s, n, d) \
+                                              TEA5767_CHANNEL_8(288, b, s, n, d) TEA5767_CHANNEL_4(296, b, s, n, d) \
+                                              TEA5767_CHANNEL_1(300, b, s, n, d)
+#else
+#error "TEA5767_CHANNEL_RASTER_KHZ must be 100 or 50"
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x01) != 0)
+static const uint16_t gsc_channel_us_europe_13mhz_low[TEA5767_CHANNEL_US_EUROPE_NUM] =
+{
+    TEA5767_CHANNEL_US_EUROPE(TEA5767_US_EUROPE_MIN_KHZ, -TEA5767_IF_KHZ, 1, 3250)
+};
+#define TEA5767_CHANNEL_US_EUROPE_13MHZ_LOW        gsc_channel_us_europe_13mhz_low
+#else
+#define TEA5767_CHANNEL_US_EUROPE_13MHZ_LOW        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x02) != 0)
+static const uint16_t gsc_channel_us_europe_13mhz_high[TEA5767_CHANNEL_US_EUROPE_NUM] =
+{
+    TEA5767_CHANNEL_US_EUROPE(TEA5767_US_EUROPE_MIN_KHZ, +TEA5767_IF_KHZ, 1, 3250)
+};
+#define TEA5767_CHANNEL_US_EUROPE_13MHZ_HIGH        gsc_channel_us_europe_13mhz_high
+#else
+#define TEA5767_CHANNEL_US_EUROPE_13MHZ_HIGH        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x01) != 0)
+static const uint16_t gsc_channel_us_europe_32p768khz_low[TEA5767_CHANNEL_US_EUROPE_NUM] =
+{
+    TEA5767_CHANNEL_US_EUROPE(TEA5767_US_EUROPE_MIN_KHZ, -TEA5767_IF_KHZ, 125, 1024)
+};
+#define TEA5767_CHANNEL_US_EUROPE_32P768KHZ_LOW        gsc_channel_us_europe_32p768khz_low
+#else
+#define TEA5767_CHANNEL_US_EUROPE_32P768KHZ_LOW        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x02) != 0)
+static const uint16_t gsc_channel_us_europe_32p768khz_high[TEA5767_CHANNEL_US_EUROPE_NUM] =
+{
+    TEA5767_CHANNEL_US_EUROPE(TEA5767_US_EUROPE_MIN_KHZ, +TEA5767_IF_KHZ, 125, 1024)
+};
+#define TEA5767_CHANNEL_US_EUROPE_32P768KHZ_HIGH        gsc_channel_us_europe_32p768khz_high
+#else
+#define TEA5767_CHANNEL_US_EUROPE_32P768KHZ_HIGH        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x04) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x01) != 0)
+static const uint16_t gsc_channel_us_europe_6p5mhz_low[TEA5767_CHANNEL_US_EUROPE_NUM] =
+{
+    TEA5767_CHANNEL_US_EUROPE(TEA5767_US_EUROPE_MIN_KHZ, -TEA5767_IF_KHZ, 1, 1625)
+};
+#define TEA5767_CHANNEL_US_EUROPE_6P5MHZ_LOW        gsc_channel_us_europe_6p5mhz_low
+#else
+#define TEA5767_CHANNEL_US_EUROPE_6P5MHZ_LOW        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x04) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x02) != 0)
+static const uint16_t gsc_channel_us_europe_6p5mhz_high[TEA5767_CHANNEL_US_EUROPE_NUM] =
+{
+    TEA5767_CHANNEL_US_EUROPE(TEA5767_US_EUROPE_MIN_KHZ, +TEA5767_IF_KHZ, 1, 1625)
+};
+#define TEA5767_CHANNEL_US_EUROPE_6P5MHZ_HIGH        gsc_channel_us_europe_6p5mhz_high
+#else
+#define TEA5767_CHANNEL_US_EUROPE_6P5MHZ_HIGH        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x01) != 0)
+static const uint16_t gsc_channel_japanese_13mhz_low[TEA5767_CHANNEL_JAPANESE_NUM] =
+{
+    TEA5767_CHANNEL_JAPANESE(TEA5767_JAPANESE_MIN_KHZ, -TEA5767_IF_KHZ, 1, 3250)
+};
+#define TEA5767_CHANNEL_JAPANESE_13MHZ_LOW        gsc_channel_japanese_13mhz_low
+#else
+#define TEA5767_CHANNEL_JAPANESE_13MHZ_LOW        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x01) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x02) != 0)
+static const uint16_t gsc_channel_japanese_13mhz_high[TEA5767_CHANNEL_JAPANESE_NUM] =
+{
+    TEA5767_CHANNEL_JAPANESE(TEA5767_JAPANESE_MIN_KHZ, +TEA5767_IF_KHZ, 1, 3250)
+};
+#define TEA5767_CHANNEL_JAPANESE_13MHZ_HIGH        gsc_channel_japanese_13mhz_high
+#else
+#define TEA5767_CHANNEL_JAPANESE_13MHZ_HIGH        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x01) != 0)
+static const uint16_t gsc_channel_japanese_32p768khz_low[TEA5767_CHANNEL_JAPANESE_NUM] =
+{
+    TEA5767_CHANNEL_JAPANESE(TEA5767_JAPANESE_MIN_KHZ, -TEA5767_IF_KHZ, 125, 1024)
+};
+#define TEA5767_CHANNEL_JAPANESE_32P768KHZ_LOW        gsc_channel_japanese_32p768khz_low
+#else
+#define TEA5767_CHANNEL_JAPANESE_32P768KHZ_LOW        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x02) != 0)
+static const uint16_t gsc_channel_japanese_32p768khz_high[TEA5767_CHANNEL_JAPANESE_NUM] =
+{
+    TEA5767_CHANNEL_JAPANESE(TEA5767_JAPANESE_MIN_KHZ, +TEA5767_IF_KHZ, 125, 1024)
+};
+#define TEA5767_CHANNEL_JAPANESE_32P768KHZ_HIGH        gsc_channel_japanese_32p768khz_high
+#else
+#define TEA5767_CHANNEL_JAPANESE_32P768KHZ_HIGH        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x04) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x01) != 0)
+static const uint16_t gsc_channel_japanese_6p5mhz_low[TEA5767_CHANNEL_JAPANESE_NUM] =
+{
+    TEA5767_CHANNEL_JAPANESE(TEA5767_JAPANESE_MIN_KHZ, -TEA5767_IF_KHZ, 1, 1625)
+};
+#define TEA5767_CHANNEL_JAPANESE_6P5MHZ_LOW        gsc_channel_japanese_6p5mhz_low
+#else
+#define TEA5767_CHANNEL_JAPANESE_6P5MHZ_LOW        NULL
+#endif
+
+#if ((TEA5767_CHANNEL_TABLE_BAND & 0x02) != 0) && ((TEA5767_CHANNEL_TABLE_CLOCK & 0x04) != 0) && ((TEA5767_CHANNEL_TABLE_SIDE & 0x02) != 0)
+static const uint16_t gsc_channel_japanese_6p5mhz_high[TEA5767_CHANNEL_JAPANESE_NUM] =
+{
+    TEA5767_CHANNEL_JAPANESE(TEA5767_JAPANESE_MIN_KHZ, +TEA5767_IF_KHZ, 1, 1625)
+};
+#define TEA5767_CHANNEL_JAPANESE_6P5MHZ_HIGH        gsc_channel_japanese_6p5mhz_high
+#else
+#define TEA5767_CHANNEL_JAPANESE_6P5MHZ_HIGH        NULL
+#endif
+
+/**
+ * @brief channel table definition, [band][clock][side]
+ */
+static const uint16_t *const gsc_channel_table[2][3][2] =
+{
+    {
+        {TEA5767_CHANNEL_US_EUROPE_13MHZ_LOW, TEA5767_CHANNEL_US_EUROPE_13MHZ_HIGH},
+        {TEA5767_CHANNEL_US_EUROPE_32P768KHZ_LOW, TEA5767_CHANNEL_US_EUROPE_32P768KHZ_HIGH},
+        {TEA5767_CHANNEL_US_EUROPE_6P5MHZ_LOW, TEA5767_CHANNEL_US_EUROPE_6P5MHZ_HIGH},
+    },
+    {
+        {TEA5767_CHANNEL_JAPANESE_13MHZ_LOW, TEA5767_CHANNEL_JAPANESE_13MHZ_HIGH},
+        {TEA5767_CHANNEL_JAPANESE_32P768KHZ_LOW, TEA5767_CHANNEL_JAPANESE_32P768KHZ_HIGH},
+        {TEA5767_CHANNEL_JAPANESE_6P5MHZ_LOW, TEA5767_CHANNEL_JAPANESE_6P5MHZ_HIGH},
+    },
+};
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle pointer to a tea5767 handle structure
@@ -129,13 +757,15 @@ uint8_t tea5767_init(tea5767_handle_t *handle)
        
         return 3;                                                        /* return error */
     }
-    if (handle->iic_read_cmd == NULL)                                    /* check iic_read_cmd */
+    if ((handle->iic_read_cmd == NULL) && 
+        (handle->iic_read_ctx_cmd == NULL))                              /* check iic_read_cmd */
     {
         handle->debug_print("tea5767: iic_read_cmd is null.\n");         /* iic_read_cmd is null */
        
         return 3;                                                        /* return error */
     }
-    if (handle->iic_write_cmd == NULL)                                   /* check iic_write_cmd */
+    if ((handle->iic_write_cmd == NULL) && 
+        (handle->iic_write_ctx_cmd == NULL))                             /* check iic_write_cmd */
     {
         handle->debug_print("tea5767: iic_write_cmd is null.\n");        /* iic_write_cmd is null */
        
@@ -154,6 +784,7 @@ uint8_t tea5767_init(tea5767_handle_t *handle)
        
         return 1;                                                        /* return error */
     }
+    handle->conf_dirty = 0x1F;                                           /* chip conf is unknown */
     handle->inited = 1;                                                  /* flag finish initialization */
     
     return 0;                                                            /* success return 0 */
@@ -184,7 +815,7 @@ uint8_t tea5767_deinit(tea5767_handle_t *handle)
     }
     
     handle->conf_up[3] |= 1 << 6;                                    /* set power down */
-    res = a_tea5767_iic_write(handle, handle->conf_up, 5);           /* write conf */
+    res = a_tea5767_flush_conf(handle, 0x00);                        /* write conf */
     if (res != 0)                                                    /* check result */
     {
         handle->debug_print("tea5767: write conf failed.\n");        /* write conf failed */
@@ -216,7 +847,43 @@ uint8_t tea5767_deinit(tea5767_handle_t *handle)
 uint8_t tea5767_write_conf(tea5767_handle_t *handle)
 {
     uint8_t res;
+    uint32_t start;
+    
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
     
+    start = a_tea5767_stats_start(handle);                                     /* get the stats start time */
+    res = a_tea5767_write_conf(handle, 5);                                     /* write conf */
+    a_tea5767_stats_stop(handle, TEA5767_STATS_OP_WRITE_CONF, start, res);     /* count the operation */
+    if (res != 0)                                                              /* check result */
+    {
+        handle->debug_print("tea5767: write conf failed.\n");                  /* write conf failed */
+       
+        return 1;                                                              /* return error */
+    }
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     flush the changed conf
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      nothing is written when the conf equals the last written conf,
+ *            otherwise only the shortest prefix covering the changed bytes is written
+ */
+uint8_t tea5767_flush_conf(tea5767_handle_t *handle)
+{
     if (handle == NULL)                                              /* check handle */
     {
         return 2;                                                    /* return error */
@@ -226,11 +893,10 @@ uint8_t tea5767_write_conf(tea5767_handle_t *handle)
         return 3;                                                    /* return error */
     }
     
-    res = a_tea5767_iic_write(handle, handle->conf_up, 5);           /* write conf */
-    if (res != 0)                                                    /* check result */
+    if (a_tea5767_flush_conf(handle, 0x00) != 0)                     /* flush conf */
     {
         handle->debug_print("tea5767: write conf failed.\n");        /* write conf failed */
-       
+        
         return 1;                                                    /* return error */
     }
     
@@ -250,74 +916,356 @@ uint8_t tea5767_write_conf(tea5767_handle_t *handle)
 uint8_t tea5767_read_conf(tea5767_handle_t *handle)
 {
     uint8_t res;
+    uint32_t start;
     
-    if (handle == NULL)                                             /* check handle */
+    if (handle == NULL)                                                       /* check handle */
     {
-        return 2;                                                   /* return error */
+        return 2;                                                             /* return error */
     }
-    if (handle->inited != 1)                                        /* check handle initialization */
+    if (handle->inited != 1)                                                  /* check handle initialization */
     {
-        return 3;                                                   /* return error */
+        return 3;                                                             /* return error */
     }
     
-    res = a_tea5767_iic_read(handle, handle->conf_down, 5);         /* read conf */
-    if (res != 0)                                                   /* check result */
+    start = a_tea5767_stats_start(handle);                                    /* get the stats start time */
+    res = a_tea5767_iic_read(handle, handle->conf_down, 5);                   /* read conf */
+    a_tea5767_stats_stop(handle, TEA5767_STATS_OP_READ_CONF, start, res);     /* count the operation */
+    if (res != 0)                                                             /* check result */
     {
-        handle->debug_print("tea5767: read conf failed.\n");        /* read conf failed */
+        handle->debug_print("tea5767: read conf failed.\n");                  /* read conf failed */
        
-        return 1;                                                   /* return error */
+        return 1;                                                             /* return error */
     }
     
-    return 0;                                                       /* success return 0 */
+    return 0;                                                                 /* success return 0 */
 }
 
 /**
- * @brief     update the conf
+ * @brief     write the conf and read the conf back
  * @param[in] *handle pointer to a tea5767 handle structure
- * @param[in] *conf pointer to a conf buffer
  * @return    status code
  *            - 0 success
+ *            - 1 write read conf failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the write and the read go out as one bus transaction when iic_write_read_cmd is linked,
+ *            otherwise they are sent one after another
  */
-uint8_t tea5767_update_conf(tea5767_handle_t *handle, uint8_t conf[5])
+uint8_t tea5767_write_read_conf(tea5767_handle_t *handle)
 {
-    if (handle == NULL)                      /* check handle */
+    uint8_t res;
+    uint32_t start;
+    
+    if (handle == NULL)                                                                   /* check handle */
     {
-        return 2;                            /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                 /* check handle initialization */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        return 3;                            /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    memcpy(handle->conf_up, conf, 5);        /* copy the conf */
+    start = a_tea5767_stats_start(handle);                                                /* get the stats start time */
+    res = a_tea5767_iic_write_read(handle, handle->conf_up, 5, handle->conf_down, 5);     /* write and read conf */
+    a_tea5767_stats_stop(handle, TEA5767_STATS_OP_WRITE_READ_CONF, start, res);           /* count the operation */
+    if (res != 0)                                                                         /* check result */
+    {
+        handle->conf_dirty = 0x1F;                                                        /* chip state is unknown */
+        handle->debug_print("tea5767: write read conf failed.\n");                        /* write read conf failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    memcpy(handle->conf_shadow, handle->conf_up, 5);                                      /* save the shadow */
+    handle->conf_dirty = 0;                                                               /* clear the dirty mask */
     
-    return 0;                                /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable the mute
+ * @brief     start writing the conf without waiting
  * @param[in] *handle pointer to a tea5767 handle structure
- * @param[in] enable bool value
  * @return    status code
  *            - 0 success
+ *            - 1 submit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      update config by tea5767_write_conf
+ *            - 4 iic_write_submit is NULL
+ *            - 5 async transfer is busy
+ * @note      the conf is copied when submitted, so it can be changed while the write is in flight,
+ *            the handle and its stats belong to the completion context until the transfer is handed back,
+ *            only the async callback or a tea5767_get_async_status that returns a status other than busy hands it back
  */
-uint8_t tea5767_set_mute(tea5767_handle_t *handle, tea5767_bool_t enable)
+uint8_t tea5767_write_conf_async(tea5767_handle_t *handle)
 {
-    if (handle == NULL)                       /* check handle */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                             /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                  /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                             /* return error */
+        return 3;                                                        /* return error */
     }
-    
+    if (handle->iic_write_submit == NULL)                                /* check the submit command */
+    {
+        handle->debug_print("tea5767: iic_write_submit is null.\n");     /* iic_write_submit is null */
+        
+        return 4;                                                        /* return error */
+    }
+    if (handle->async_status == TEA5767_ASYNC_STATUS_BUSY)               /* check the async status */
+    {
+        handle->debug_print("tea5767: async transfer is busy.\n");       /* async transfer is busy */
+        
+        return 5;                                                        /* return error */
+    }
+    
+    memcpy(handle->async_buf, handle->conf_up, 5);                       /* copy the conf */
+    handle->async_op = TEA5767_ASYNC_OP_WRITE_CONF;                      /* set the operation */
+    handle->async_status = TEA5767_ASYNC_STATUS_BUSY;                    /* set busy before the done can run */
+    handle->async_start = a_tea5767_stats_start(handle);                 /* get the stats start time */
+    if (handle->iic_write_submit(handle->bus_ctx, TEA5767_ADDRESS, handle->async_buf, 5,
+                                 a_tea5767_async_done, handle) != 0)     /* submit the write */
+    {
+        handle->async_status = TEA5767_ASYNC_STATUS_FAILED;              /* nothing was sent */
+        handle->debug_print("tea5767: submit failed.\n");                /* submit failed */
+        
+        return 1;                                                        /* return error */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     start reading the conf without waiting
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_submit is NULL
+ *            - 5 async transfer is busy
+ * @note      the read conf is copied to the handle when the read finishes,
+ *            the handle and its stats belong to the completion context until the transfer is handed back,
+ *            only the async callback or a tea5767_get_async_status that returns a status other than busy hands it back
+ */
+uint8_t tea5767_read_conf_async(tea5767_handle_t *handle)
+{
+    if (handle == NULL)                                                 /* check handle */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (handle->inited != 1)                                            /* check handle initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    if (handle->iic_read_submit == NULL)                                /* check the submit command */
+    {
+        handle->debug_print("tea5767: iic_read_submit is null.\n");     /* iic_read_submit is null */
+        
+        return 4;                                                       /* return error */
+    }
+    if (handle->async_status == TEA5767_ASYNC_STATUS_BUSY)              /* check the async status */
+    {
+        handle->debug_print("tea5767: async transfer is busy.\n");      /* async transfer is busy */
+        
+        return 5;                                                       /* return error */
+    }
+    
+    handle->async_op = TEA5767_ASYNC_OP_READ_CONF;                      /* set the operation */
+    handle->async_status = TEA5767_ASYNC_STATUS_BUSY;                   /* set busy before the done can run */
+    handle->async_start = a_tea5767_stats_start(handle);                /* get the stats start time */
+    if (handle->iic_read_submit(handle->bus_ctx, TEA5767_ADDRESS, handle->async_buf, 5,
+                                a_tea5767_async_done, handle) != 0)     /* submit the read */
+    {
+        handle->async_status = TEA5767_ASYNC_STATUS_FAILED;             /* nothing was sent */
+        handle->debug_print("tea5767: submit failed.\n");               /* submit failed */
+        
+        return 1;                                                       /* return error */
+    }
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      get the async transfer status
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *status pointer to an async status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a status other than busy hands the conf buffers and the stats back to the caller,
+ *             reading handle->async_status directly does not
+ */
+uint8_t tea5767_get_async_status(tea5767_handle_t *handle, tea5767_async_status_t *status)
+{
+    if (handle == NULL)                                           /* check handle */
+    {
+        return 2;                                                 /* return error */
+    }
+    if (handle->inited != 1)                                      /* check handle initialization */
+    {
+        return 3;                                                 /* return error */
+    }
+    
+    *status = (tea5767_async_status_t)(handle->async_status);     /* get the async status */
+    TEA5767_ASYNC_BARRIER();                                      /* read the status before the conf and the stats */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief     read the status prefix
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] nbytes read length
+ * @return    status code
+ *            - 0 success
+ *            - 1 read status failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 nbytes is invalid
+ * @note      1 <= nbytes <= 5, byte 0 holds ready, band limit and pll high,
+ *            byte 1 holds pll low, byte 2 holds stereo and if, byte 3 holds the level
+ */
+uint8_t tea5767_read_status(tea5767_handle_t *handle, uint8_t nbytes)
+{
+    uint8_t res;
+    uint32_t start;
+    
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    if ((nbytes == 0) || (nbytes > 5))                                          /* check the nbytes */
+    {
+        handle->debug_print("tea5767: nbytes is invalid.\n");                   /* nbytes is invalid */
+        
+        return 4;                                                               /* return error */
+    }
+    
+    start = a_tea5767_stats_start(handle);                                      /* get the stats start time */
+    res = a_tea5767_iic_read(handle, handle->conf_down, nbytes);                /* read status */
+    a_tea5767_stats_stop(handle, TEA5767_STATS_OP_READ_STATUS, start, res);     /* count the operation */
+    if (res != 0)                                                               /* check result */
+    {
+        handle->debug_print("tea5767: read status failed.\n");                  /* read status failed */
+        
+        return 1;                                                               /* return error */
+    }
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      read and decode all status fields
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *status pointer to a tea5767 status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read status failed
+ *             - 2 handle or status is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ * @note       one 4 bytes read, the frequency uses the local clock and side injection settings
+ */
+uint8_t tea5767_read_status_snapshot(tea5767_handle_t *handle, tea5767_status_t *status)
+{
+    uint8_t res;
+    uint8_t clk;
+    uint32_t side;
+    uint32_t start;
+    
+    if ((handle == NULL) || (status == NULL))                                                        /* check handle and status */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                                         /* check handle initialization */
+    {
+        return 3;                                                                                    /* return error */
+    }
+    clk = (uint8_t)(((handle->conf_up[4] >> 7) & 0x01) << 1 | ((handle->conf_up[3] >> 4) & 0x01));   /* get the clock */
+    if (clk > 0x02)                                                                                  /* check the clock */
+    {
+        handle->debug_print("tea5767: clock is invalid.\n");                                         /* clock is invalid */
+        
+        return 4;                                                                                    /* return error */
+    }
+    
+    start = a_tea5767_stats_start(handle);                                                           /* get the stats start time */
+    res = a_tea5767_iic_read(handle, handle->conf_down, 4);                                          /* read up to the level */
+    a_tea5767_stats_stop(handle, TEA5767_STATS_OP_READ_STATUS, start, res);                          /* count the operation */
+    if (res != 0)                                                                                    /* check result */
+    {
+        handle->debug_print("tea5767: read status failed.\n");                                       /* read status failed */
+        
+        return 1;                                                                                    /* return error */
+    }
+    
+    status->ready = (tea5767_bool_t)((handle->conf_down[0] >> 7) & 0x01);                            /* decode the ready flag */
+    status->band_limit = (tea5767_bool_t)((handle->conf_down[0] >> 6) & 0x01);                       /* decode the band limit flag */
+    status->pll = (uint16_t)(((uint16_t)(handle->conf_down[0] & 0x3F) << 8) | handle->conf_down[1]); /* decode the searched pll */
+    status->reception = (tea5767_reception_t)((handle->conf_down[2] >> 7) & 0x01);                   /* decode the reception */
+    status->if_out = handle->conf_down[2] & 0x7F;                                                    /* decode the if */
+    status->level = (handle->conf_down[3] >> 4) & 0x0F;                                              /* decode the level */
+    side = (handle->conf_up[2] >> 4) & 0x01;                                                         /* 1 means high side lo injection */
+    (void)a_tea5767_pll_to_khz(clk, side, status->pll, &status->khz);                                /* convert raw data to real data, 0 if out of range */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     update the conf
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *conf pointer to a conf buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t tea5767_update_conf(tea5767_handle_t *handle, uint8_t conf[5])
+{
+    if (handle == NULL)                      /* check handle */
+    {
+        return 2;                            /* return error */
+    }
+    if (handle->inited != 1)                 /* check handle initialization */
+    {
+        return 3;                            /* return error */
+    }
+    
+    memcpy(handle->conf_up, conf, 5);        /* copy the conf */
+    
+    return 0;                                /* success return 0 */
+}
+
+#if (TEA5767_FAST_ACCESSORS == 0)
+
+/**
+ * @brief     enable or disable the mute
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      update config by tea5767_write_conf
+ */
+uint8_t tea5767_set_mute(tea5767_handle_t *handle, tea5767_bool_t enable)
+{
+    if (handle == NULL)                       /* check handle */
+    {
+        return 2;                             /* return error */
+    }
+    if (handle->inited != 1)                  /* check handle initialization */
+    {
+        return 3;                             /* return error */
+    }
+    
     handle->conf_up[0] &= ~(1 << 7);          /* clear settings */
     handle->conf_up[0] |= enable << 7;        /* set settings */
     
@@ -1479,126 +2427,1767 @@ uint8_t tea5767_get_level_adc_output(tea5767_handle_t *handle, uint8_t *output)
     return 0;                                           /* success return 0 */
 }
 
+#endif
+
 /**
- * @brief      convert the frequency to the register raw data
+ * @brief      read the ready flag from the chip
  * @param[in]  *handle pointer to a tea5767 handle structure
- * @param[in]  mhz radio frequency in MHz
- * @param[out] *pll pointer to a pll buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- *             - 4 clock is invalid
- * @note       none
+ * @note       only the first 1 byte of the conf down is read
  */
-uint8_t tea5767_frequency_convert_to_register(tea5767_handle_t *handle, float mhz, uint16_t *pll)
+uint8_t tea5767_read_ready_flag(tea5767_handle_t *handle, tea5767_bool_t *enable)
 {
-    uint8_t hlsi;
-    uint8_t clk;
-    float f;
-    
-    if (handle == NULL)                                                  /* check handle */
+    if (handle == NULL)                                                    /* check handle */
     {
-        return 2;                                                        /* return error */
+        return 2;                                                          /* return error */
     }
-    if (handle->inited != 1)                                             /* check handle initialization */
+    if (handle->inited != 1)                                               /* check handle initialization */
     {
-        return 3;                                                        /* return error */
+        return 3;                                                          /* return error */
     }
     
-    hlsi = (handle->conf_up[2] >> 4) & 0x01;                             /* get hte hlsi */
-    clk = ((handle->conf_up[4] >> 7) & 0x01) << 1 
-             | ((handle->conf_up[3] >> 4) & 0x01);                       /* get the clock */
-    if (clk == 0x00)                                                     /* 13MHz */
-    {
-        f = 13000.0f;                                                    /* 13MHz */
-    }
-    else if (clk == 0x01)                                                /* 32.768KHz */
+    if (a_tea5767_iic_read(handle, handle->conf_down, 1) != 0)             /* read conf */
     {
-        f = 32.768f;                                                     /* 32.768KHz */
+        handle->debug_print("tea5767: read conf failed.\n");               /* read conf failed */
+        
+        return 1;                                                          /* return error */
     }
-    else if (clk == 0x02)                                                /* 6.5MHz */
+    *enable = (tea5767_bool_t)((handle->conf_down[0] >> 7) & 0x01);        /* get the settings */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      read the band limit flag from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 1 byte of the conf down is read
+ */
+uint8_t tea5767_read_band_limit_flag(tea5767_handle_t *handle, tea5767_bool_t *enable)
+{
+    if (handle == NULL)                                                    /* check handle */
     {
-        f = 6500.0f;                                                     /* 6.5MHz */
+        return 2;                                                          /* return error */
     }
-    else
+    if (handle->inited != 1)                                               /* check handle initialization */
     {
-        handle->debug_print("tea5767: clock is invalid.\n");             /* clock is invalid */
-       
-        return 4;                                                        /* return error */
+        return 3;                                                          /* return error */
     }
     
-    if (hlsi != 0)                                                       /* high side lo injection */
+    if (a_tea5767_iic_read(handle, handle->conf_down, 1) != 0)             /* read conf */
     {
-        *pll = (uint16_t)((4.0f * (mhz * 1000.0f + 225.0f)) / f);        /* convert real data to raw data */
-    }                                                                    /* low side lo injection */
-    else
-    {
-        *pll = (uint16_t)((4.0f * (mhz * 1000.0f - 225.0f)) / f);        /* convert real data to raw data */
+        handle->debug_print("tea5767: read conf failed.\n");               /* read conf failed */
+        
+        return 1;                                                          /* return error */
     }
+    *enable = (tea5767_bool_t)((handle->conf_down[0] >> 6) & 0x01);        /* get the settings */
     
-    return 0;                                                            /* success return 0 */
+    return 0;                                                              /* success return 0 */
 }
 
 /**
- * @brief      convert the register raw data to the frequency
+ * @brief      read the searched pll from the chip
  * @param[in]  *handle pointer to a tea5767 handle structure
- * @param[in]  pll register raw data
- * @param[out] *mhz pointer to a frequency buffer
+ * @param[out] *pll pointer to a pll buffer
  * @return     status code
  *             - 0 success
+ *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- *             - 4 clock is invalid
- * @note       none
+ * @note       only the first 2 bytes of the conf down are read
  */
-uint8_t tea5767_frequency_convert_to_data(tea5767_handle_t *handle, uint16_t pll, float *mhz)
+uint8_t tea5767_read_searched_pll(tea5767_handle_t *handle, uint16_t *pll)
 {
-    uint8_t hlsi;
-    uint8_t clk;
-    float f;
-    
-    if (handle == NULL)                                                  /* check handle */
+    if (handle == NULL)                                                                  /* check handle */
     {
-        return 2;                                                        /* return error */
+        return 2;                                                                        /* return error */
     }
-    if (handle->inited != 1)                                             /* check handle initialization */
+    if (handle->inited != 1)                                                             /* check handle initialization */
     {
-        return 3;                                                        /* return error */
+        return 3;                                                                        /* return error */
     }
     
-    hlsi = (handle->conf_up[2] >> 4) & 0x01;                             /* get hte hlsi */
-    clk = ((handle->conf_up[4] >> 7) & 0x01) << 1 
-             | ((handle->conf_up[3] >> 4) & 0x01);                       /* get the clock */
-    if (clk == 0x00)                                                     /* 13MHz */
+    if (a_tea5767_iic_read(handle, handle->conf_down, 2) != 0)                           /* read conf */
     {
-        f = 13000.0f;                                                    /* 13MHz */
+        handle->debug_print("tea5767: read conf failed.\n");                             /* read conf failed */
+        
+        return 1;                                                                        /* return error */
     }
-    else if (clk == 0x01)                                                /* 32.768KHz */
+    *pll = ((uint16_t)(handle->conf_down[0] & 0x3F) << 8) | handle->conf_down[1];        /* get the settings */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      read the if from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *if_out pointer to an if out buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 3 bytes of the conf down are read
+ */
+uint8_t tea5767_read_if(tea5767_handle_t *handle, uint8_t *if_out)
+{
+    if (handle == NULL)                                               /* check handle */
     {
-        f = 32.768f;                                                     /* 32.768KHz */
+        return 2;                                                     /* return error */
     }
-    else if (clk == 0x02)                                                /* 6.5MHz */
+    if (handle->inited != 1)                                          /* check handle initialization */
     {
-        f = 6500.0f;                                                     /* 6.5MHz */
+        return 3;                                                     /* return error */
     }
-    else
+    
+    if (a_tea5767_iic_read(handle, handle->conf_down, 3) != 0)        /* read conf */
     {
-        handle->debug_print("tea5767: clock is invalid.\n");             /* clock is invalid */
-       
+        handle->debug_print("tea5767: read conf failed.\n");          /* read conf failed */
+        
+        return 1;                                                     /* return error */
+    }
+    *if_out = handle->conf_down[2] & 0x7F;                            /* get the settings */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      read the reception from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *reception pointer to a reception buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 3 bytes of the conf down are read
+ */
+uint8_t tea5767_read_reception(tea5767_handle_t *handle, tea5767_reception_t *reception)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    if (a_tea5767_iic_read(handle, handle->conf_down, 3) != 0)                     /* read conf */
+    {
+        handle->debug_print("tea5767: read conf failed.\n");                       /* read conf failed */
+        
+        return 1;                                                                  /* return error */
+    }
+    *reception = (tea5767_reception_t)((handle->conf_down[2] >> 7) & 0x01);        /* get the settings */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read the level adc output from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *output pointer to a level adc output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 4 bytes of the conf down are read
+ */
+uint8_t tea5767_read_level_adc_output(tea5767_handle_t *handle, uint8_t *output)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    if (a_tea5767_iic_read(handle, handle->conf_down, 4) != 0)        /* read conf */
+    {
+        handle->debug_print("tea5767: read conf failed.\n");          /* read conf failed */
+        
+        return 1;                                                     /* return error */
+    }
+    *output = (handle->conf_down[3] >> 4) & 0xF;                      /* get the settings */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      convert the frequency to the register raw data
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  mhz radio frequency in MHz
+ * @param[out] *pll pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ * @note       none
+ */
+uint8_t tea5767_frequency_convert_to_register(tea5767_handle_t *handle, float mhz, uint16_t *pll)
+{
+    uint8_t hlsi;
+    uint8_t clk;
+    float f;
+    
+    if (handle == NULL)                                                  /* check handle */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (handle->inited != 1)                                             /* check handle initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    
+    hlsi = (handle->conf_up[2] >> 4) & 0x01;                             /* get hte hlsi */
+    clk = ((handle->conf_up[4] >> 7) & 0x01) << 1 
+             | ((handle->conf_up[3] >> 4) & 0x01);                       /* get the clock */
+    if (clk == 0x00)                                                     /* 13MHz */
+    {
+        f = 13000.0f;                                                    /* 13MHz */
+    }
+    else if (clk == 0x01)                                                /* 32.768KHz */
+    {
+        f = 32.768f;                                                     /* 32.768KHz */
+    }
+    else if (clk == 0x02)                                                /* 6.5MHz */
+    {
+        f = 6500.0f;                                                     /* 6.5MHz */
+    }
+    else
+    {
+        handle->debug_print("tea5767: clock is invalid.\n");             /* clock is invalid */
+       
+        return 4;                                                        /* return error */
+    }
+    
+    if (hlsi != 0)                                                       /* high side lo injection */
+    {
+        *pll = (uint16_t)((4.0f * (mhz * 1000.0f + 225.0f)) / f);        /* convert real data to raw data */
+    }                                                                    /* low side lo injection */
+    else
+    {
+        *pll = (uint16_t)((4.0f * (mhz * 1000.0f - 225.0f)) / f);        /* convert real data to raw data */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the frequency
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  pll register raw data
+ * @param[out] *mhz pointer to a frequency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ * @note       none
+ */
+uint8_t tea5767_frequency_convert_to_data(tea5767_handle_t *handle, uint16_t pll, float *mhz)
+{
+    uint8_t hlsi;
+    uint8_t clk;
+    float f;
+    
+    if (handle == NULL)                                                  /* check handle */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (handle->inited != 1)                                             /* check handle initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    
+    hlsi = (handle->conf_up[2] >> 4) & 0x01;                             /* get hte hlsi */
+    clk = ((handle->conf_up[4] >> 7) & 0x01) << 1 
+             | ((handle->conf_up[3] >> 4) & 0x01);                       /* get the clock */
+    if (clk == 0x00)                                                     /* 13MHz */
+    {
+        f = 13000.0f;                                                    /* 13MHz */
+    }
+    else if (clk == 0x01)                                                /* 32.768KHz */
+    {
+        f = 32.768f;                                                     /* 32.768KHz */
+    }
+    else if (clk == 0x02)                                                /* 6.5MHz */
+    {
+        f = 6500.0f;                                                     /* 6.5MHz */
+    }
+    else
+    {
+        handle->debug_print("tea5767: clock is invalid.\n");             /* clock is invalid */
+       
         return 4;                                                        /* return error */
     }
     
-    if (hlsi != 0)                                                       /* high side lo injection */
+    if (hlsi != 0)                                                       /* high side lo injection */
+    {
+        *mhz = (pll * f / 4.0f - 255.0f) / 1000.0f;                      /* convert raw data to real data */
+    }                                                                    /* low side lo injection */
+    else
+    {
+        *mhz = (pll * f / 4.0f + 255.0f) / 1000.0f;                      /* convert raw data to real data */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert the frequency in KHz to the pll
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  khz radio frequency in KHz
+ * @param[out] *pll pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 khz is out of range
+ * @note       integer only, pll is the exact floor of 4 * (khz +/- 225) / clock in KHz
+ */
+uint8_t tea5767_khz_to_pll(tea5767_handle_t *handle, uint32_t khz, uint16_t *pll)
+{
+    uint8_t clk;
+    uint32_t lo;
+    uint32_t res;
+    
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    clk = ((handle->conf_up[4] >> 7) & 0x01) << 1 
+             | ((handle->conf_up[3] >> 4) & 0x01);                                 /* get the clock */
+    if (clk > 0x02)                                                                /* check the clock */
+    {
+        handle->debug_print("tea5767: clock is invalid.\n");                       /* clock is invalid */
+        
+        return 4;                                                                  /* return error */
+    }
+    if (((handle->conf_up[2] >> 4) & 0x01) != 0)                                   /* high side lo injection */
+    {
+        lo = khz + TEA5767_IF_KHZ;                                                 /* lo is above */
+    }
+    else                                                                           /* low side lo injection */
+    {
+        if (khz < TEA5767_IF_KHZ)                                                  /* check the khz */
+        {
+            handle->debug_print("tea5767: khz is out of range.\n");                /* khz is out of range */
+            
+            return 5;                                                              /* return error */
+        }
+        lo = khz - TEA5767_IF_KHZ;                                                 /* lo is below */
+    }
+    res = lo * gsc_pll_ratio[clk][0] / gsc_pll_ratio[clk][1];                      /* convert real data to raw data */
+    if ((lo > 0x00FFFFFFUL) || (res > 0x3FFF))                                     /* check the range */
+    {
+        handle->debug_print("tea5767: khz is out of range.\n");                    /* khz is out of range */
+        
+        return 5;                                                                  /* return error */
+    }
+    *pll = (uint16_t)res;                                                          /* save the pll */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      convert the pll to the frequency in KHz
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  pll register raw data
+ * @param[out] *khz pointer to a frequency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 pll is out of range
+ * @note       integer only, returns the lowest frequency that tea5767_khz_to_pll maps back to the same pll
+ */
+uint8_t tea5767_pll_to_khz(tea5767_handle_t *handle, uint16_t pll, uint32_t *khz)
+{
+    uint8_t clk;
+    
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (pll > 0x3FFF)                                                              /* check the pll */
+    {
+        handle->debug_print("tea5767: pll is out of range.\n");                    /* pll is out of range */
+        
+        return 5;                                                                  /* return error */
+    }
+    
+    clk = ((handle->conf_up[4] >> 7) & 0x01) << 1 
+             | ((handle->conf_up[3] >> 4) & 0x01);                                 /* get the clock */
+    if (clk > 0x02)                                                                /* check the clock */
+    {
+        handle->debug_print("tea5767: clock is invalid.\n");                       /* clock is invalid */
+        
+        return 4;                                                                  /* return error */
+    }
+    if (a_tea5767_pll_to_khz(clk, (handle->conf_up[2] >> 4) & 0x01, 
+                             pll, khz) == 0)                                       /* convert raw data to real data */
+    {
+        handle->debug_print("tea5767: pll is out of range.\n");                    /* pll is out of range */
+        
+        return 5;                                                                  /* return error */
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     tune to a channel of the raster
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] index channel index from the band min
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 index is over the band
+ *            - 5 channel table is stripped
+ * @note      the table is selected by the local band, clock and side injection,
+ *            the pll is loaded from the table and only the changed conf prefix is written
+ */
+uint8_t tea5767_set_channel_index(tea5767_handle_t *handle, uint16_t index)
+{
+    uint8_t band;
+    uint8_t clk;
+    uint16_t pll;
+    const uint16_t *table;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    band = (handle->conf_up[3] >> 5) & 0x01;                                              /* get the band */
+    if (index >= ((band != 0) ? TEA5767_CHANNEL_JAPANESE_NUM : TEA5767_CHANNEL_US_EUROPE_NUM))
+    {
+        handle->debug_print("tea5767: index is over the band.\n");                        /* index is over the band */
+        
+        return 4;                                                                         /* return error */
+    }
+    clk = ((handle->conf_up[4] >> 7) & 0x01) << 1 
+             | ((handle->conf_up[3] >> 4) & 0x01);                                        /* get the clock */
+    table = (clk > 0x02) ? NULL : gsc_channel_table[band][clk][(handle->conf_up[2] >> 4) & 0x01];
+    if (table == NULL)                                                                    /* check the table */
+    {
+        handle->debug_print("tea5767: channel table is stripped.\n");                     /* channel table is stripped */
+        
+        return 5;                                                                         /* return error */
+    }
+    
+    pll = table[index];                                                                   /* load the pll */
+    handle->conf_up[0] &= ~0x3F;                                                          /* clear settings */
+    handle->conf_up[0] |= (pll >> 8) & 0x3F;                                              /* set the pll */
+    handle->conf_up[1] = pll & 0xFF;                                                      /* set the pll */
+    if (a_tea5767_flush_conf(handle, 0x00) != 0)                                          /* write conf */
+    {
+        handle->debug_print("tea5767: write conf failed.\n");                             /* write conf failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     start a non-blocking search
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] mode search mode
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the search starts from the local pll, advance it by tea5767_search_poll
+ */
+uint8_t tea5767_search_start(tea5767_handle_t *handle, tea5767_search_mode_t mode, uint32_t ms)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    handle->conf_up[2] &= ~(1 << 7);                                       /* clear settings */
+    handle->conf_up[2] |= mode << 7;                                       /* set search mode */
+    handle->conf_up[0] |= 1 << 6;                                          /* set search mode */
+    res = a_tea5767_flush_conf(handle, 0x01);                              /* always restart the search */
+    if (res != 0)                                                          /* check result */
+    {
+        handle->debug_print("tea5767: write conf failed.\n");              /* write conf failed */
+        handle->search_status = TEA5767_SEARCH_STATUS_IDLE;                /* set idle */
+        
+        return 1;                                                          /* return error */
+    }
+    handle->search_status = TEA5767_SEARCH_STATUS_BUSY;                    /* set busy */
+    handle->search_start_ms = ms;                                          /* save the start timestamp */
+    handle->search_next_ms = ms + TEA5767_SEARCH_SETTLE_MS;                /* wait the pll settling time */
+    handle->search_interval_ms = TEA5767_SEARCH_MIN_INTERVAL_MS;           /* set the min interval */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      poll the non-blocking search
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *status pointer to a search status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read or write conf failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function never sleeps and only touches the bus when the poll interval has elapsed,
+ *             the poll interval starts after the pll settling time and doubles up to a limit,
+ *             when the search finishes the searched pll is saved in local, the mode is set back to normal
+ *             and the search callback is called, a timeout tunes the chip back to the local pll
+ *             like tea5767_search_stop
+ */
+uint8_t tea5767_search_poll(tea5767_handle_t *handle, uint32_t ms, tea5767_search_status_t *status)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    
+    if ((handle->search_status != TEA5767_SEARCH_STATUS_BUSY) ||                             /* check the status */
+        ((int32_t)(ms - handle->search_next_ms) < 0))                                        /* check the poll time */
+    {
+        *status = (tea5767_search_status_t)(handle->search_status);                          /* get the status */
+        
+        return 0;                                                                            /* success return 0 */
+    }
+    
+    res = a_tea5767_iic_read(handle, handle->conf_down, 2);                                  /* read the flags and the pll */
+    if (res != 0)                                                                            /* check result */
+    {
+        handle->debug_print("tea5767: read conf failed.\n");                                 /* read conf failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    if (((handle->conf_down[0] >> 7) & 0x01) == 0)                                           /* check the ready flag */
+    {
+        if ((ms - handle->search_start_ms) >= TEA5767_SEARCH_TIMEOUT_MS)                     /* check the timeout */
+        {
+            handle->search_status = TEA5767_SEARCH_STATUS_TIMEOUT;                           /* set timeout */
+        }
+        else
+        {
+            handle->search_next_ms = ms + handle->search_interval_ms;                        /* set the next poll time */
+            handle->search_interval_ms *= 2;                                                 /* back off */
+            if (handle->search_interval_ms > TEA5767_SEARCH_MAX_INTERVAL_MS)                 /* check the interval */
+            {
+                handle->search_interval_ms = TEA5767_SEARCH_MAX_INTERVAL_MS;                 /* set the max interval */
+            }
+            *status = TEA5767_SEARCH_STATUS_BUSY;                                            /* set busy */
+            
+            return 0;                                                                        /* success return 0 */
+        }
+    }
+    else if (((handle->conf_down[0] >> 6) & 0x01) != 0)                                      /* check the band limit flag */
+    {
+        handle->search_status = TEA5767_SEARCH_STATUS_BAND_LIMIT;                            /* set band limit */
+    }
+    else
+    {
+        handle->search_status = TEA5767_SEARCH_STATUS_FOUND;                                 /* set found */
+    }
+    
+    handle->conf_up[0] &= ~(1 << 6);                                                         /* set normal mode */
+    res = 0;                                                                                 /* init 0 */
+    if (handle->search_status != TEA5767_SEARCH_STATUS_TIMEOUT)                              /* check the status */
+    {
+        handle->conf_up[0] &= ~0x3F;                                                         /* clear settings */
+        handle->conf_up[0] |= handle->conf_down[0] & 0x3F;                                   /* save the searched pll */
+        handle->conf_up[1] = handle->conf_down[1];                                           /* save the searched pll */
+    }
+    else
+    {
+        res = a_tea5767_flush_conf(handle, 0x01);                                            /* leave the search mode */
+        if (res != 0)                                                                        /* check result */
+        {
+            handle->debug_print("tea5767: write conf failed.\n");                            /* write conf failed */
+        }
+    }
+    *status = (tea5767_search_status_t)(handle->search_status);                              /* get the status */
+    a_tea5767_stats_add(handle, TEA5767_STATS_OP_SEARCH, (ms - handle->search_start_ms) * 1000, 
+                        (*status == TEA5767_SEARCH_STATUS_TIMEOUT) ? 1 : 0);                 /* count the search */
+    if (handle->search_callback != NULL)                                                     /* check the search callback */
+    {
+        handle->search_callback(handle, *status, ((uint16_t)(handle->conf_up[0] & 0x3F) << 8) | 
+                                handle->conf_up[1]);                                         /* run the search callback */
+    }
+    if (res != 0)                                                                            /* check the retune */
+    {
+        return 1;                                                                            /* return error */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     stop the non-blocking search
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the chip is tuned back to the local pll
+ */
+uint8_t tea5767_search_stop(tea5767_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                              /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (handle->inited != 1)                                         /* check handle initialization */
+    {
+        return 3;                                                    /* return error */
+    }
+    
+    handle->conf_up[0] &= ~(1 << 6);                                 /* set normal mode */
+    handle->search_status = TEA5767_SEARCH_STATUS_IDLE;              /* set idle */
+    res = a_tea5767_flush_conf(handle, 0x01);                        /* always retune */
+    if (res != 0)                                                    /* check result */
+    {
+        handle->debug_print("tea5767: write conf failed.\n");        /* write conf failed */
+        
+        return 1;                                                    /* return error */
+    }
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     tune the pll for the scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] pll tuned pll
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ * @note      none
+ */
+static uint8_t a_tea5767_scan_tune(tea5767_handle_t *handle, uint16_t pll, uint32_t ms)
+{
+    handle->conf_up[0] &= ~((1 << 6) | 0x3F);                               /* set normal mode and clear the pll */
+    handle->conf_up[0] |= (pll >> 8) & 0x3F;                                /* set the pll */
+    handle->conf_up[1] = pll & 0xFF;                                        /* set the pll */
+    if (a_tea5767_flush_conf(handle, 0x01) != 0)                            /* always retune */
+    {
+        handle->debug_print("tea5767: write conf failed.\n");               /* write conf failed */
+        
+        return 1;                                                           /* return error */
+    }
+    handle->scan.pll = pll;                                                 /* save the tuned pll */
+    handle->scan.phase = TEA5767_SCAN_PHASE_TUNE;                           /* set the tune phase */
+    handle->scan.tune_ms = ms;                                              /* save the tune timestamp */
+    handle->scan.next_ms = ms + TEA5767_SEARCH_SETTLE_MS;                   /* wait the pll settling time */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     start the next search of the scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] pll search start pll
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 search start failed
+ * @note      none
+ */
+static uint8_t a_tea5767_scan_search(tea5767_handle_t *handle, uint16_t pll, uint32_t ms)
+{
+    handle->conf_up[0] &= ~0x3F;                                            /* clear the pll */
+    handle->conf_up[0] |= (pll >> 8) & 0x3F;                                /* set the pll */
+    handle->conf_up[1] = pll & 0xFF;                                        /* set the pll */
+    if (tea5767_search_start(handle, TEA5767_SEARCH_MODE_UP, ms) != 0)      /* start search up */
+    {
+        return 1;                                                           /* return error */
+    }
+    handle->scan.phase = TEA5767_SCAN_PHASE_SEARCH;                         /* set the search phase */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     finish the scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] res scan result
+ * @return    status code
+ *            - 0 success
+ *            - 1 scan failed
+ * @note      the local conf and the search callback are restored
+ */
+static uint8_t a_tea5767_scan_finish(tea5767_handle_t *handle, uint8_t res)
+{
+    memcpy(handle->conf_up, handle->scan.conf, 5);                          /* restore the conf */
+    handle->conf_up[0] &= ~(1 << 6);                                        /* set normal mode */
+    handle->search_callback = handle->scan.callback;                        /* restore the callback */
+    handle->search_status = TEA5767_SEARCH_STATUS_IDLE;                     /* set idle */
+    if (a_tea5767_flush_conf(handle, 0x00) != 0)                            /* write conf */
+    {
+        handle->debug_print("tea5767: write conf failed.\n");               /* write conf failed */
+        res = 1;                                                            /* set error */
+    }
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("tea5767: scan failed.\n");                     /* scan failed */
+        handle->scan.status = TEA5767_SCAN_STATUS_ERROR;                    /* set error */
+        
+        return 1;                                                           /* return error */
+    }
+    handle->scan.status = TEA5767_SCAN_STATUS_DONE;                         /* set done */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief         add the tuned station to the table
+ * @param[in]     *handle pointer to a tea5767 handle structure
+ * @param[in]     pll tuned pll
+ * @param[in]     khz tuned frequency in KHz
+ * @param[in]     stop search stop level
+ * @param[in]     step pll step of one raster
+ * @param[out]    *station pointer to a station table
+ * @param[in,out] *num pointer to a station number buffer
+ * @note          a station next to the last one is treated as the same station and the stronger one is kept
+ */
+static void a_tea5767_scan_add(tea5767_handle_t *handle, uint16_t pll, uint32_t khz, uint8_t stop, uint16_t step,
+                               tea5767_station_t *station, uint16_t *num)
+{
+    uint8_t level;
+    uint8_t if_out;
+    tea5767_station_t *s;
+    
+    level = (handle->conf_down[3] >> 4) & 0xF;                                    /* get the level */
+    if_out = handle->conf_down[2] & 0x7F;                                         /* get the if */
+    if ((level < stop) || (if_out < TEA5767_SCAN_IF_MIN) || (if_out > TEA5767_SCAN_IF_MAX))
+    {
+        return;                                                                   /* not a station */
+    }
+    if ((*num != 0) && ((uint16_t)(pll - station[*num - 1].pll) <= step))         /* check the last station */
+    {
+        if (station[*num - 1].level >= level)                                     /* check the level */
+        {
+            return;                                                               /* keep the last station */
+        }
+        s = &station[*num - 1];                                                   /* replace the last station */
+    }
+    else
+    {
+        s = &station[*num];                                                       /* append a station */
+        (*num)++;                                                                 /* add the number */
+    }
+    s->pll = pll;                                                                 /* save the pll */
+    s->level = level;                                                             /* save the level */
+    s->if_out = if_out;                                                           /* save the if */
+    s->reception = (tea5767_reception_t)((handle->conf_down[2] >> 7) & 0x01);     /* save the reception */
+    s->khz = khz;                                                                 /* save the frequency */
+    s->mhz = (float)khz / 1000.0f;                                                /* derive the frequency in MHz */
+}
+
+/**
+ * @brief     run one step of the scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 scan failed
+ * @note      none
+ */
+static uint8_t a_tea5767_scan_step(tea5767_handle_t *handle, uint32_t ms)
+{
+    uint16_t pll;
+    uint32_t khz;
+    tea5767_search_status_t search;
+    
+    if (handle->scan.phase == TEA5767_SCAN_PHASE_SEARCH)                                           /* search phase */
+    {
+        if (tea5767_search_poll(handle, ms, &search) != 0)                                         /* poll the search */
+        {
+            return a_tea5767_scan_finish(handle, 1);                                               /* finish the scan */
+        }
+        if (search == TEA5767_SEARCH_STATUS_BUSY)                                                  /* check the status */
+        {
+            return 0;                                                                              /* still searching */
+        }
+        if (search == TEA5767_SEARCH_STATUS_BAND_LIMIT)                                            /* check the band limit */
+        {
+            return a_tea5767_scan_finish(handle, 0);                                               /* finish the scan */
+        }
+        if (search == TEA5767_SEARCH_STATUS_TIMEOUT)                                               /* check the timeout */
+        {
+            handle->debug_print("tea5767: search timeout.\n");                                     /* search timeout */
+            
+            return a_tea5767_scan_finish(handle, 1);                                               /* finish the scan */
+        }
+        
+        pll = ((uint16_t)(handle->conf_up[0] & 0x3F) << 8) | handle->conf_up[1];                   /* get the searched pll */
+        if (tea5767_pll_to_khz(handle, pll, &khz) != 0)                                            /* convert the pll */
+        {
+            return a_tea5767_scan_finish(handle, 1);                                               /* finish the scan */
+        }
+        khz = (khz < handle->scan.min_khz) ? handle->scan.min_khz : khz;                           /* limit the frequency */
+        khz = handle->scan.min_khz + (khz - handle->scan.min_khz + TEA5767_SCAN_RASTER_KHZ / 2)
+              / TEA5767_SCAN_RASTER_KHZ * TEA5767_SCAN_RASTER_KHZ;                                 /* align to the raster */
+        if (khz > handle->scan.max_khz)                                                            /* check the band */
+        {
+            return a_tea5767_scan_finish(handle, 0);                                               /* finish the scan */
+        }
+        handle->scan.searched_pll = pll;                                                           /* save the searched pll */
+        handle->scan.khz = khz;                                                                    /* save the raster frequency */
+        if ((tea5767_khz_to_pll(handle, khz, &pll) != 0) ||                                        /* convert the raster */
+            (a_tea5767_scan_tune(handle, pll, ms) != 0))                                           /* tune the raster */
+        {
+            return a_tea5767_scan_finish(handle, 1);                                               /* finish the scan */
+        }
+        
+        return 0;                                                                                  /* success return 0 */
+    }
+    
+    if ((int32_t)(ms - handle->scan.next_ms) < 0)                                                  /* check the poll time */
+    {
+        return 0;                                                                                  /* still settling */
+    }
+    if (a_tea5767_iic_read(handle, handle->conf_down, 4) != 0)                                     /* read up to the level */
+    {
+        handle->debug_print("tea5767: read conf failed.\n");                                       /* read conf failed */
+        
+        return a_tea5767_scan_finish(handle, 1);                                                   /* finish the scan */
+    }
+    if (((handle->conf_down[0] >> 7) & 0x01) == 0)                                                 /* check the ready flag */
+    {
+        if ((ms - handle->scan.tune_ms) >= TEA5767_SEARCH_TIMEOUT_MS)                              /* check the timeout */
+        {
+            handle->debug_print("tea5767: tune timeout.\n");                                       /* tune timeout */
+            
+            return a_tea5767_scan_finish(handle, 1);                                               /* finish the scan */
+        }
+        handle->scan.next_ms = ms + TEA5767_SEARCH_MIN_INTERVAL_MS;                                /* set the next poll time */
+        
+        return 0;                                                                                  /* success return 0 */
+    }
+    a_tea5767_scan_add(handle, handle->scan.pll, handle->scan.khz, handle->scan.stop, handle->scan.step,
+                       handle->scan.station, &handle->scan.num);                                   /* add the station */
+    if (handle->scan.num >= handle->scan.len)                                                      /* check the table */
+    {
+        return a_tea5767_scan_finish(handle, 0);                                                   /* finish the scan */
+    }
+    
+    if (handle->scan.mode == TEA5767_SCAN_MODE_SWEEP)                                              /* stepped pll sweep */
+    {
+        handle->scan.khz += TEA5767_SCAN_RASTER_KHZ;                                               /* next channel */
+        if (handle->scan.khz > handle->scan.max_khz)                                               /* check the band */
+        {
+            return a_tea5767_scan_finish(handle, 0);                                               /* finish the scan */
+        }
+        if ((tea5767_khz_to_pll(handle, handle->scan.khz, &pll) != 0) ||                           /* convert the frequency */
+            (a_tea5767_scan_tune(handle, pll, ms) != 0))                                           /* tune the channel */
+        {
+            return a_tea5767_scan_finish(handle, 1);                                               /* finish the scan */
+        }
+    }
+    else                                                                                           /* chained hardware search */
+    {
+        pll = (handle->scan.pll > handle->scan.searched_pll) ?
+               handle->scan.pll : handle->scan.searched_pll;                                       /* search from the higher pll */
+        if (a_tea5767_scan_search(handle, pll, ms) != 0)                                           /* start the next search */
+        {
+            return a_tea5767_scan_finish(handle, 1);                                               /* finish the scan */
+        }
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      scan the whole band
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  mode scan mode
+ * @param[out] *station pointer to a station table
+ * @param[in]  len station table length
+ * @param[out] *num pointer to a found station number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the band and the search stop level are taken from the local conf,
+ *             stations are aligned to the 100KHz raster and kept only when the if counter is in 0x31 - 0x3E,
+ *             the scan stops when the table is full and the local conf is written back at the end,
+ *             this function runs tea5767_scan_start and tea5767_scan_poll with a 1ms tick
+ */
+uint8_t tea5767_scan(tea5767_handle_t *handle, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint16_t *num)
+{
+    uint32_t ms;
+    tea5767_scan_status_t status;
+    
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    ms = 0;                                                                  /* init 0 */
+    *num = 0;                                                                /* init 0 */
+    if (tea5767_scan_start(handle, mode, station, len, ms) != 0)             /* start the scan */
+    {
+        return 1;                                                            /* return error */
+    }
+    while (1)
+    {
+        (void)tea5767_scan_poll(handle, ms, &status, num);                   /* poll the scan */
+        if (status != TEA5767_SCAN_STATUS_BUSY)                              /* check the status */
+        {
+            break;                                                           /* break */
+        }
+        handle->delay_ms(1);                                                 /* delay 1ms */
+        ms++;                                                                /* add the time */
+    }
+    if (status != TEA5767_SCAN_STATUS_DONE)                                  /* check the status */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     start a non-blocking scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] mode scan mode
+ * @param[in] *station pointer to a station table
+ * @param[in] len station table length
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 scan start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 scan or search is busy
+ * @note      the station table must stay valid until the scan is done, advance it by tea5767_scan_poll,
+ *            a running scan or search must finish or be stopped before a new scan starts
+ */
+uint8_t tea5767_scan_start(tea5767_handle_t *handle, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint32_t ms)
+{
+    uint8_t res;
+    uint8_t ssl;
+    uint16_t pll;
+    uint16_t step;
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    if ((handle->scan.status == TEA5767_SCAN_STATUS_BUSY) || 
+        (handle->search_status == TEA5767_SEARCH_STATUS_BUSY))                                     /* check the scan and the search */
+    {
+        handle->debug_print("tea5767: scan or search is busy.\n");                                 /* scan or search is busy */
+        
+        return 4;                                                                                  /* return error */
+    }
+    
+    if (((handle->conf_up[3] >> 5) & 0x01) != 0)                                                   /* Japanese band */
+    {
+        handle->scan.min_khz = TEA5767_JAPANESE_MIN_KHZ;                                           /* set min */
+        handle->scan.max_khz = TEA5767_JAPANESE_MAX_KHZ;                                           /* set max */
+    }
+    else
+    {
+        handle->scan.min_khz = TEA5767_US_EUROPE_MIN_KHZ;                                          /* set min */
+        handle->scan.max_khz = TEA5767_US_EUROPE_MAX_KHZ;                                          /* set max */
+    }
+    ssl = (handle->conf_up[2] >> 5) & 0x03;                                                        /* get the search stop level */
+    if (ssl == 3)                                                                                  /* high */
+    {
+        handle->scan.stop = 10;                                                                    /* level 10 */
+    }
+    else if (ssl == 2)                                                                             /* mid */
+    {
+        handle->scan.stop = 7;                                                                     /* level 7 */
+    }
+    else                                                                                           /* low */
+    {
+        handle->scan.stop = 5;                                                                     /* level 5 */
+    }
+    if ((tea5767_khz_to_pll(handle, handle->scan.min_khz, &pll) != 0) ||
+        (tea5767_khz_to_pll(handle, handle->scan.min_khz + TEA5767_SCAN_RASTER_KHZ, &step) != 0))   /* get the raster step */
+    {
+        handle->scan.status = TEA5767_SCAN_STATUS_ERROR;                                           /* set error */
+        
+        return 1;                                                                                  /* return error */
+    }
+    
+    handle->scan.step = step - pll;                                                                /* pll step of one raster */
+    handle->scan.mode = (uint8_t)mode;                                                             /* save the mode */
+    handle->scan.station = station;                                                                /* save the table */
+    handle->scan.len = len;                                                                        /* save the length */
+    handle->scan.num = 0;                                                                          /* init 0 */
+    memcpy(handle->scan.conf, handle->conf_up, 5);                                                 /* save the conf */
+    handle->scan.callback = handle->search_callback;                                               /* save the callback */
+    handle->search_callback = NULL;                                                                /* no callback when scanning */
+    handle->scan.status = TEA5767_SCAN_STATUS_BUSY;                                                /* set busy */
+    if (len == 0)                                                                                  /* check the length */
+    {
+        return a_tea5767_scan_finish(handle, 0);                                                   /* nothing to scan */
+    }
+    if (mode == TEA5767_SCAN_MODE_SWEEP)                                                           /* stepped pll sweep */
+    {
+        handle->scan.khz = handle->scan.min_khz;                                                   /* start from the band min */
+        res = tea5767_khz_to_pll(handle, handle->scan.khz, &pll);                                  /* convert the band min */
+        if (res == 0)                                                                              /* check the result */
+        {
+            res = a_tea5767_scan_tune(handle, pll, ms);                                            /* tune the first channel */
+        }
+    }
+    else                                                                                           /* chained hardware search */
+    {
+        res = tea5767_khz_to_pll(handle, handle->scan.min_khz - TEA5767_SCAN_RASTER_KHZ / 2, 
+                                 &pll);                                                            /* start half a raster below the band */
+        if (res == 0)                                                                              /* check the result */
+        {
+            res = a_tea5767_scan_search(handle, pll, ms);                                          /* start the first search */
+        }
+    }
+    if (res != 0)                                                                                  /* check the result */
+    {
+        (void)a_tea5767_scan_finish(handle, 1);                                                    /* finish the scan */
+        
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      poll the non-blocking scan
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *status pointer to a scan status buffer
+ * @param[out] *num pointer to a found station number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function never sleeps and only touches the bus when a step is due,
+ *             a bus error ends the scan with TEA5767_SCAN_STATUS_ERROR
+ */
+uint8_t tea5767_scan_poll(tea5767_handle_t *handle, uint32_t ms, tea5767_scan_status_t *status, uint16_t *num)
+{
+    if (handle == NULL)                                                                            /* check handle */
     {
-        *mhz = (pll * f / 4.0f - 255.0f) / 1000.0f;                      /* convert raw data to real data */
-    }                                                                    /* low side lo injection */
-    else
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
     {
-        *mhz = (pll * f / 4.0f + 255.0f) / 1000.0f;                      /* convert raw data to real data */
+        return 3;                                                                                  /* return error */
     }
     
-    return 0;                                                            /* success return 0 */
+    if (handle->scan.status == TEA5767_SCAN_STATUS_BUSY)                                           /* check the status */
+    {
+        (void)a_tea5767_scan_step(handle, ms);                                                     /* the status carries the result */
+    }
+    *status = (tea5767_scan_status_t)(handle->scan.status);                                        /* get the status */
+    *num = handle->scan.num;                                                                       /* get the number */
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     stop the non-blocking scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a running scan ends with TEA5767_SCAN_STATUS_DONE, the local conf is restored
+ *            and the stations found so far are kept
+ */
+uint8_t tea5767_scan_stop(tea5767_handle_t *handle)
+{
+    if (handle == NULL)                                                 /* check handle */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (handle->inited != 1)                                            /* check handle initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    
+    if (handle->scan.status != TEA5767_SCAN_STATUS_BUSY)                /* check the status */
+    {
+        return 0;                                                       /* nothing to stop */
+    }
+    if (a_tea5767_scan_finish(handle, 0) != 0)                          /* finish the scan */
+    {
+        return 1;                                                       /* return error */
+    }
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      run one step of a task
+ * @param[in]  *task pointer to a tea5767 task structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *status pointer to a task status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 task is NULL
+ *             - 4 task is not prepared
+ * @note       this function never sleeps, the step function only runs when the task is busy and its wake time is due
+ */
+uint8_t tea5767_task_step(tea5767_task_t *task, uint32_t ms, tea5767_task_status_t *status)
+{
+    if (task == NULL)                                                      /* check task */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (task->step == NULL)                                                /* check the step function */
+    {
+        return 4;                                                          /* return error */
+    }
+    
+    if ((task->status == TEA5767_TASK_STATUS_BUSY) &&                      /* check the status */
+        ((int32_t)(ms - task->wake_ms) >= 0))                              /* check the wake time */
+    {
+        task->status = task->step(task, ms);                               /* run the step function */
+    }
+    *status = (tea5767_task_status_t)(task->status);                       /* get the status */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     prepare a task
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] *step pointer to a step function address
+ * @param[in] *arg pointer to the step argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 task is NULL
+ *            - 4 step is NULL
+ * @note      the first step runs on the next tea5767_task_step call
+ */
+uint8_t tea5767_task_init(tea5767_task_t *task, uint8_t (*step)(tea5767_task_t *task, uint32_t ms), void *arg)
+{
+    if (task == NULL)                                      /* check task */
+    {
+        return 2;                                          /* return error */
+    }
+    if (step == NULL)                                      /* check step */
+    {
+        return 4;                                          /* return error */
+    }
+    
+    memset(task, 0, sizeof(tea5767_task_t));               /* clear the task */
+    task->step = step;                                     /* set the step function */
+    task->arg = arg;                                       /* set the step argument */
+    task->status = TEA5767_TASK_STATUS_BUSY;               /* run at once */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     run a task to the end with blocking delays
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a prepared tea5767 task structure
+ * @return    status code of the operation
+ * @note      the task timestamps start from 0 and only advance by the slept time
+ */
+static uint8_t a_tea5767_task_run(tea5767_handle_t *handle, tea5767_task_t *task)
+{
+    uint32_t ms;
+    tea5767_task_status_t status;
+    
+    ms = 0;                                                          /* init 0 */
+    while (1)
+    {
+        (void)tea5767_task_step(task, ms, &status);                  /* run the task */
+        if (status != TEA5767_TASK_STATUS_BUSY)                      /* check the status */
+        {
+            break;                                                   /* break */
+        }
+        if ((int32_t)(task->wake_ms - ms) > 0)                       /* check the wake time */
+        {
+            handle->delay_ms(task->wake_ms - ms);                    /* sleep until the next step */
+            ms = task->wake_ms;                                      /* add the time */
+        }
+    }
+    
+    return task->res;                                                /* return the status code */
+}
+
+/**
+ * @brief     search step function
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] ms current timestamp in ms
+ * @return    tea5767_task_status_t
+ * @note      none
+ */
+static uint8_t a_tea5767_search_task_step(tea5767_task_t *task, uint32_t ms)
+{
+    tea5767_handle_t *handle = (tea5767_handle_t *)task->arg;
+    tea5767_search_status_t status;
+    
+    TEA5767_TASK_BEGIN(task);
+    if (tea5767_search_start(handle, (tea5767_search_mode_t)task->mode, ms) != 0)        /* start the search */
+    {
+        TEA5767_TASK_EXIT(task, 1);                                                      /* search failed */
+    }
+    while (1)
+    {
+        if (tea5767_search_poll(handle, ms, &status) != 0)                               /* poll the search */
+        {
+            TEA5767_TASK_EXIT(task, 1);                                                  /* search failed */
+        }
+        if (status != TEA5767_SEARCH_STATUS_BUSY)                                        /* check the status */
+        {
+            break;                                                                       /* break */
+        }
+        TEA5767_TASK_WAIT_UNTIL(task, handle->search_next_ms);                           /* yield until the next poll */
+    }
+    if (status == TEA5767_SEARCH_STATUS_BAND_LIMIT)                                      /* check the band limit */
+    {
+        TEA5767_TASK_EXIT(task, 4);                                                      /* band limit reached */
+    }
+    if (status != TEA5767_SEARCH_STATUS_FOUND)                                           /* check the found status */
+    {
+        TEA5767_TASK_EXIT(task, 1);                                                      /* search failed */
+    }
+    TEA5767_TASK_END(task);
+}
+
+/**
+ * @brief     prepare a search task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] mode search mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ * @note      the task runs tea5767_search_start and tea5767_search_poll and yields between the polls,
+ *            the task result is 0 for a found station, 1 for a failed search and 4 for the band limit
+ */
+uint8_t tea5767_search_task(tea5767_handle_t *handle, tea5767_task_t *task, tea5767_search_mode_t mode)
+{
+    if ((handle == NULL) || (task == NULL))                                  /* check handle and task */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    (void)tea5767_task_init(task, a_tea5767_search_task_step, handle);       /* prepare the task */
+    task->mode = (uint8_t)mode;                                              /* set the search mode */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     scan step function
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] ms current timestamp in ms
+ * @return    tea5767_task_status_t
+ * @note      none
+ */
+static uint8_t a_tea5767_scan_task_step(tea5767_task_t *task, uint32_t ms)
+{
+    tea5767_handle_t *handle = (tea5767_handle_t *)task->arg;
+    tea5767_scan_status_t status;
+    
+    TEA5767_TASK_BEGIN(task);
+    if (tea5767_scan_start(handle, (tea5767_scan_mode_t)task->mode, 
+                           task->station, task->len, ms) != 0)                            /* start the scan */
+    {
+        TEA5767_TASK_EXIT(task, 1);                                                       /* scan failed */
+    }
+    while (1)
+    {
+        if (tea5767_scan_poll(handle, ms, &status, &task->num) != 0)                      /* poll the scan */
+        {
+            TEA5767_TASK_EXIT(task, 1);                                                   /* scan failed */
+        }
+        if (status != TEA5767_SCAN_STATUS_BUSY)                                           /* check the status */
+        {
+            break;                                                                        /* break */
+        }
+        TEA5767_TASK_WAIT_UNTIL(task, (handle->scan.phase == TEA5767_SCAN_PHASE_SEARCH) ?
+                                handle->search_next_ms : handle->scan.next_ms);           /* yield until the next step */
+    }
+    if (status != TEA5767_SCAN_STATUS_DONE)                                               /* check the status */
+    {
+        TEA5767_TASK_EXIT(task, 1);                                                       /* scan failed */
+    }
+    TEA5767_TASK_END(task);
+}
+
+/**
+ * @brief     prepare a scan task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] mode scan mode
+ * @param[in] *station pointer to a station table
+ * @param[in] len station table length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ * @note      the task runs tea5767_scan_start and tea5767_scan_poll and yields between the steps,
+ *            the found station number is saved in task->num
+ */
+uint8_t tea5767_scan_task(tea5767_handle_t *handle, tea5767_task_t *task, tea5767_scan_mode_t mode, 
+                          tea5767_station_t *station, uint16_t len)
+{
+    if ((handle == NULL) || (task == NULL))                                /* check handle and task */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    (void)tea5767_task_init(task, a_tea5767_scan_task_step, handle);       /* prepare the task */
+    task->mode = (uint8_t)mode;                                            /* set the scan mode */
+    task->station = station;                                               /* set the station table */
+    task->len = len;                                                       /* set the table length */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     get the clock of the local conf
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    clock index, 0x03 is invalid
+ * @note      none
+ */
+static uint8_t a_tea5767_get_clock(tea5767_handle_t *handle)
+{
+    return ((handle->conf_up[4] >> 7) & 0x01) << 1
+             | ((handle->conf_up[3] >> 4) & 0x01);        /* get the clock */
+}
+
+/**
+ * @brief     afc step function
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] ms current timestamp in ms
+ * @return    tea5767_task_status_t
+ * @note      every read waits for the ready flag by yielding the poll interval
+ */
+static uint8_t a_tea5767_afc_task_step(tea5767_task_t *task, uint32_t ms)
+{
+    tea5767_handle_t *handle = (tea5767_handle_t *)task->arg;
+    uint8_t clk;
+    int32_t offset;
+    int32_t step;
+    int32_t pll;
+    
+    TEA5767_TASK_BEGIN(task);
+    for (task->i = 0; task->i <= TEA5767_AFC_MAX_STEP; task->i++)                       /* measure and correct */
+    {
+        task->start_ms = ms;                                                            /* save the wait start */
+        while (1)                                                                       /* wait the settled pll */
+        {
+            if (a_tea5767_iic_read(handle, handle->conf_down, 3) != 0)                  /* read up to the if counter */
+            {
+                handle->debug_print("tea5767: read conf failed.\n");                    /* read conf failed */
+                
+                TEA5767_TASK_EXIT(task, 1);                                             /* return error */
+            }
+            if (((handle->conf_down[0] >> 7) & 0x01) != 0)                              /* check the ready flag */
+            {
+                break;                                                                  /* break */
+            }
+            if ((ms - task->start_ms) >= TEA5767_SEARCH_TIMEOUT_MS)                     /* check the timeout */
+            {
+                handle->debug_print("tea5767: tune timeout.\n");                        /* tune timeout */
+                
+                TEA5767_TASK_EXIT(task, 1);                                             /* return error */
+            }
+            TEA5767_TASK_SLEEP(task, ms, TEA5767_SEARCH_MIN_INTERVAL_MS);               /* yield the poll interval */
+        }
+        task->if_out = handle->conf_down[2] & 0x7F;                                     /* get the if counter */
+        if ((task->if_out >= TEA5767_SCAN_IF_MIN) && 
+            (task->if_out <= TEA5767_SCAN_IF_MAX))                                      /* check the if window */
+        {
+            TEA5767_TASK_EXIT(task, 0);                                                 /* success */
+        }
+        offset = (int32_t)(task->if_out) - TEA5767_AFC_IF_CENTER;                       /* get the if offset */
+        if ((offset > TEA5767_AFC_IF_RANGE) || (offset < -TEA5767_AFC_IF_RANGE))        /* check the capture range */
+        {
+            handle->debug_print("tea5767: no carrier.\n");                              /* no carrier */
+            
+            TEA5767_TASK_EXIT(task, 5);                                                 /* return error */
+        }
+        if (task->i == TEA5767_AFC_MAX_STEP)                                            /* check the last measurement */
+        {
+            break;                                                                      /* break */
+        }
+        
+        clk = a_tea5767_get_clock(handle);                                              /* get the clock */
+        step = offset * TEA5767_AFC_IF_STEP_HZ * gsc_pll_ratio[clk][0];                 /* if offset in Hz */
+        step = (step + ((step < 0) ? -1 : 1) * (int32_t)gsc_pll_ratio[clk][1] * 500)
+               / ((int32_t)gsc_pll_ratio[clk][1] * 1000);                               /* predict the pll correction */
+        if (step == 0)                                                                  /* check the correction */
+        {
+            step = (offset < 0) ? -1 : 1;                                               /* at least one pll step */
+        }
+        pll = ((int32_t)(handle->conf_down[0] & 0x3F) << 8) | handle->conf_down[1];     /* get the tuned pll */
+        if (((handle->conf_up[2] >> 4) & 0x01) != 0)                                    /* high side lo injection */
+        {
+            pll -= step;                                                                /* if = lo - rf */
+        }
+        else
+        {
+            pll += step;                                                                /* if = rf - lo */
+        }
+        if ((pll < 0) || (pll > 0x3FFF))                                                /* check the pll */
+        {
+            handle->debug_print("tea5767: pll is out of range.\n");                     /* pll is out of range */
+            
+            TEA5767_TASK_EXIT(task, 1);                                                 /* return error */
+        }
+        handle->conf_up[0] = (handle->conf_up[0] & 0x80) | ((pll >> 8) & 0x3F);         /* keep the mute, clear the search mode */
+        handle->conf_up[1] = pll & 0xFF;                                                /* set the pll low */
+        if (a_tea5767_flush_conf(handle, 0x00) != 0)                                    /* write the changed conf */
+        {
+            handle->debug_print("tea5767: write conf failed.\n");                       /* write conf failed */
+            
+            TEA5767_TASK_EXIT(task, 1);                                                 /* return error */
+        }
+        TEA5767_TASK_SLEEP(task, ms, TEA5767_SEARCH_SETTLE_MS);                         /* yield the pll settling */
+    }
+    handle->debug_print("tea5767: afc is not converged.\n");                            /* afc is not converged */
+    TEA5767_TASK_EXIT(task, 6);                                                         /* return error */
+    TEA5767_TASK_END(task);
+}
+
+/**
+ * @brief     prepare an afc task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ *            - 4 clock is invalid
+ * @note      the task result is the status code of tea5767_afc and the if counter is saved in task->if_out
+ */
+uint8_t tea5767_afc_task(tea5767_handle_t *handle, tea5767_task_t *task)
+{
+    if ((handle == NULL) || (task == NULL))                               /* check handle and task */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    if (a_tea5767_get_clock(handle) > 0x02)                               /* check the clock */
+    {
+        handle->debug_print("tea5767: clock is invalid.\n");              /* clock is invalid */
+        
+        return 4;                                                         /* return error */
+    }
+    
+    (void)tea5767_task_init(task, a_tea5767_afc_task_step, handle);       /* prepare the task */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      fine tune the pll by the if counter
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *if_out pointer to an if counter output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 afc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 no carrier
+ *             - 6 afc is not converged
+ * @note       call it after a preset tune or a search, the if counter is moved into 0x31 - 0x3E,
+ *             every correction is predicted from the if offset and costs one pll write and one 3 bytes read,
+ *             a tuned station needs only the first read,
+ *             this function runs the afc task with blocking delays
+ */
+uint8_t tea5767_afc(tea5767_handle_t *handle, uint8_t *if_out)
+{
+    uint8_t res;
+    tea5767_task_t task;
+    
+    res = tea5767_afc_task(handle, &task);              /* prepare the task */
+    if (res != 0)                                       /* check the result */
+    {
+        return res;                                     /* return error */
+    }
+    res = a_tea5767_task_run(handle, &task);            /* run the task */
+    *if_out = task.if_out;                              /* get the if counter */
+    
+    return res;                                         /* return the result */
+}
+
+/**
+ * @brief     set the pll and the side injection of the local conf
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] high high side injection flag
+ * @param[in] pll precomputed pll of the side
+ * @note      none
+ */
+static void a_tea5767_set_side(tea5767_handle_t *handle, uint8_t high, uint16_t pll)
+{
+    handle->conf_up[0] = (handle->conf_up[0] & 0x80) | ((pll >> 8) & 0x3F);     /* keep the mute, clear the search mode */
+    handle->conf_up[1] = pll & 0xFF;                                            /* set the pll low */
+    handle->conf_up[2] &= ~(1 << 4);                                            /* clear the side injection */
+    handle->conf_up[2] |= high << 4;                                            /* set the side injection */
+}
+
+/**
+ * @brief     tune optimal step function
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] ms current timestamp in ms
+ * @return    tea5767_task_status_t
+ * @note      the level adc follows the new pll only after it settles, so the read that shares
+ *            the transaction of the low side image write still holds the high side image level
+ */
+static uint8_t a_tea5767_tune_optimal_task_step(tea5767_task_t *task, uint32_t ms)
+{
+    tea5767_handle_t *handle = (tea5767_handle_t *)task->arg;
+    
+    TEA5767_TASK_BEGIN(task);
+    a_tea5767_set_side(handle, 1, task->pll[1]);                                             /* high side at f + 450KHz */
+    if (a_tea5767_flush_conf(handle, 0x00) != 0)                                             /* tune the high side image */
+    {
+        handle->debug_print("tea5767: write conf failed.\n");                                /* write conf failed */
+        
+        TEA5767_TASK_EXIT(task, 1);                                                          /* return error */
+    }
+    TEA5767_TASK_SLEEP(task, ms, TEA5767_SEARCH_SETTLE_MS);                                  /* yield the pll settling */
+    a_tea5767_set_side(handle, 0, task->pll[0]);                                             /* low side at f - 450KHz */
+    if (a_tea5767_flush_read_conf(handle, 4) != 0)                                           /* tune the low side image and read the high side level */
+    {
+        handle->debug_print("tea5767: write read conf failed.\n");                           /* write read conf failed */
+        
+        TEA5767_TASK_EXIT(task, 1);                                                          /* return error */
+    }
+    task->level[1] = (handle->conf_down[3] >> 4) & 0x0F;                                     /* get the high side image level */
+    for (task->i = 0; task->i < 3; task->i += 2)                                             /* low side image, then the tune */
+    {
+        if (task->i == 2)                                                                    /* both images are measured */
+        {
+            task->side = (uint8_t)(task->level[1] < task->level[0]);                         /* the side with the weaker image wins */
+            a_tea5767_set_side(handle, task->side, task->pll[2 + task->side]);               /* tune the frequency */
+            if (a_tea5767_flush_conf(handle, 0x00) != 0)                                     /* write the changed conf */
+            {
+                handle->debug_print("tea5767: write conf failed.\n");                        /* write conf failed */
+                
+                TEA5767_TASK_EXIT(task, 1);                                                  /* return error */
+            }
+        }
+        TEA5767_TASK_SLEEP(task, ms, TEA5767_SEARCH_SETTLE_MS);                              /* yield the pll settling */
+        task->start_ms = ms;                                                                 /* save the wait start */
+        while (1)                                                                            /* wait the settled pll */
+        {
+            if (a_tea5767_iic_read(handle, handle->conf_down, 4) != 0)                       /* read up to the level */
+            {
+                handle->debug_print("tea5767: read conf failed.\n");                         /* read conf failed */
+                
+                TEA5767_TASK_EXIT(task, 1);                                                  /* return error */
+            }
+            if (((handle->conf_down[0] >> 7) & 0x01) != 0)                                   /* check the ready flag */
+            {
+                break;                                                                       /* break */
+            }
+            if ((ms - task->start_ms) >= TEA5767_SEARCH_TIMEOUT_MS)                          /* check the timeout */
+            {
+                handle->debug_print("tea5767: tune timeout.\n");                             /* tune timeout */
+                
+                TEA5767_TASK_EXIT(task, 1);                                                  /* return error */
+            }
+            TEA5767_TASK_SLEEP(task, ms, TEA5767_SEARCH_MIN_INTERVAL_MS);                    /* yield the poll interval */
+        }
+        task->level[task->i] = (handle->conf_down[3] >> 4) & 0x0F;                           /* get the level */
+    }
+    TEA5767_TASK_END(task);
+}
+
+/**
+ * @brief     prepare a tune optimal task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] khz radio frequency in KHz
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ *            - 4 clock is invalid
+ *            - 5 khz is out of range
+ * @note      all pll words are precomputed here, the task result is the status code of tea5767_tune_optimal,
+ *            the image levels are saved in task->level[0] and task->level[1] by side injection,
+ *            the chosen side is saved in task->side and the tuned level in task->level[2]
+ */
+uint8_t tea5767_tune_optimal_task(tea5767_handle_t *handle, tea5767_task_t *task, uint32_t khz)
+{
+    uint8_t clk;
+    uint8_t i;
+    uint16_t pll[4];
+    uint32_t offset;
+    uint32_t lo;
+    uint32_t raw;
+    
+    if ((handle == NULL) || (task == NULL))                                     /* check handle and task */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    
+    clk = a_tea5767_get_clock(handle);                                          /* get the clock */
+    if (clk > 0x02)                                                             /* check the clock */
+    {
+        handle->debug_print("tea5767: clock is invalid.\n");                    /* clock is invalid */
+        
+        return 4;                                                               /* return error */
+    }
+    for (i = 0; i < 4; i++)                                                     /* precompute all pll words */
+    {
+        offset = (i < 2) ? (3 * TEA5767_IF_KHZ) : TEA5767_IF_KHZ;               /* the image is 2 if away from the frequency */
+        if ((i & 0x01) != 0)                                                    /* high side lo injection */
+        {
+            lo = khz + offset;                                                  /* lo is above */
+        }
+        else if (khz >= offset)                                                 /* low side lo injection */
+        {
+            lo = khz - offset;                                                  /* lo is below */
+        }
+        else
+        {
+            lo = 0x01000000UL;                                                  /* out of range */
+        }
+        raw = lo * gsc_pll_ratio[clk][0] / gsc_pll_ratio[clk][1];               /* convert real data to raw data */
+        if ((lo > 0x00FFFFFFUL) || (raw > 0x3FFF))                              /* check the range */
+        {
+            handle->debug_print("tea5767: khz is out of range.\n");             /* khz is out of range */
+            
+            return 5;                                                           /* return error */
+        }
+        pll[i] = (uint16_t)raw;                                                 /* save the pll */
+    }
+    
+    (void)tea5767_task_init(task, a_tea5767_tune_optimal_task_step, 
+                            handle);                                            /* prepare the task */
+    for (i = 0; i < 4; i++)                                                     /* copy all pll words */
+    {
+        task->pll[i] = pll[i];                                                  /* images, then the tunes, low side first */
+    }
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      tune a frequency with the cleaner side injection
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  khz radio frequency in KHz
+ * @param[out] *side pointer to a chosen side injection buffer
+ * @param[out] *level pointer to a level adc output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 tune optimal failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 khz is out of range
+ * @note       the datasheet procedure, the level is measured at f + 450KHz with the high side injection
+ *             and at f - 450KHz with the low side injection, the side with the lower image level wins,
+ *             the high side level is read in the same transaction as the low side write,
+ *             the chip is left tuned with the chosen side, the local conf follows it and level is the tuned level,
+ *             this function runs the tune optimal task with blocking delays
+ */
+uint8_t tea5767_tune_optimal(tea5767_handle_t *handle, uint32_t khz, tea5767_side_injection_t *side, uint8_t *level)
+{
+    uint8_t res;
+    tea5767_task_t task;
+    
+    res = tea5767_tune_optimal_task(handle, &task, khz);         /* prepare the task */
+    if (res != 0)                                                /* check the result */
+    {
+        return res;                                              /* return error */
+    }
+    res = a_tea5767_task_run(handle, &task);                     /* run the task */
+    if (res != 0)                                                /* check the result */
+    {
+        return res;                                              /* return error */
+    }
+    *side = (tea5767_side_injection_t)(task.side);               /* save the side */
+    *level = task.level[2];                                      /* save the tuned level */
+    
+    return 0;                                                    /* success return 0 */
 }
 
 /**
@@ -1624,6 +4213,8 @@ uint8_t tea5767_set_reg(tea5767_handle_t *handle, uint8_t *buf, uint16_t len)
         return 3;                                        /* return error */
     }
     
+    handle->conf_dirty = 0x1F;                           /* chip conf is overwritten */
+    
     return a_tea5767_iic_write(handle, buf, len);        /* write command */
 }
 
@@ -56,6 +56,78 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief tea5767 channel table build option definition
+ * @note  TEA5767_CHANNEL_RASTER_KHZ is 100 or 50,
+ *        each mask strips the tables of the cleared bits and 0 strips all tables
+ */
+#ifndef TEA5767_CHANNEL_RASTER_KHZ
+#define TEA5767_CHANNEL_RASTER_KHZ        100         /**< channel raster in KHz */
+#endif
+#ifndef TEA5767_CHANNEL_TABLE_BAND
+#define TEA5767_CHANNEL_TABLE_BAND        0x03        /**< bit0 US/Europe, bit1 Japanese */
+#endif
+#ifndef TEA5767_CHANNEL_TABLE_CLOCK
+#define TEA5767_CHANNEL_TABLE_CLOCK       0x07        /**< bit0 13MHz, bit1 32.768KHz, bit2 6.5MHz */
+#endif
+#ifndef TEA5767_CHANNEL_TABLE_SIDE
+#define TEA5767_CHANNEL_TABLE_SIDE        0x03        /**< bit0 low side, bit1 high side */
+#endif
+
+/**
+ * @brief tea5767 bus trace build option definition
+ * @note  0 compiles the trace hook out of the iic functions
+ */
+#ifndef TEA5767_TRACE
+#define TEA5767_TRACE                     1           /**< bus trace hook */
+#endif
+
+/**
+ * @brief tea5767 operation stats build option definition
+ * @note  0 compiles the stats hook out of the driver
+ */
+#ifndef TEA5767_STATS
+#define TEA5767_STATS                     1           /**< operation stats hook */
+#endif
+
+/**
+ * @brief tea5767 async barrier build option definition
+ * @note  the barrier orders the async results against the async status when the done runs on another core
+ */
+#ifndef TEA5767_ASYNC_BARRIER
+#if defined(__GNUC__)
+#define TEA5767_ASYNC_BARRIER()           __sync_synchronize()      /**< full memory barrier */
+#else
+#define TEA5767_ASYNC_BARRIER()                                     /**< single core targets need no barrier */
+#endif
+#endif
+
+/**
+ * @brief tea5767 fast accessors build option definition
+ * @note  1 turns the local conf getters and setters into static inline functions,
+ *        the handle and range checks are kept only when NDEBUG is not defined
+ */
+#ifndef TEA5767_FAST_ACCESSORS
+#define TEA5767_FAST_ACCESSORS            0           /**< static inline accessors */
+#endif
+
+/**
+ * @brief tea5767 bus trace definition
+ */
+#define TEA5767_TRACE_DATA_SIZE              12        /**< stored bytes of one transfer */
+
+/**
+ * @brief tea5767 operation stats definition
+ */
+#define TEA5767_STATS_OP_NUM                 8         /**< instrumented operations */
+#define TEA5767_STATS_BUCKET_NUM             24        /**< log2 latency buckets, the last one holds 8s and more */
+
+/**
+ * @brief tea5767 channel number definition
+ */
+#define TEA5767_CHANNEL_US_EUROPE_NUM        ((108000 - 87500) / TEA5767_CHANNEL_RASTER_KHZ + 1)        /**< 87.5MHz - 108MHz */
+#define TEA5767_CHANNEL_JAPANESE_NUM         ((91000 - 76000) / TEA5767_CHANNEL_RASTER_KHZ + 1)         /**< 76MHz - 91MHz */
+
 /**
  * @brief tea5767 bool enumeration definition
  */
@@ -157,6 +229,304 @@ typedef enum
     TEA5767_RECEPTION_STEREO = 0x01,        /**< stereo */
 } tea5767_reception_t;
 
+/**
+ * @brief tea5767 search status enumeration definition
+ */
+typedef enum
+{
+    TEA5767_SEARCH_STATUS_IDLE       = 0x00,        /**< no search */
+    TEA5767_SEARCH_STATUS_BUSY       = 0x01,        /**< searching */
+    TEA5767_SEARCH_STATUS_FOUND      = 0x02,        /**< station found */
+    TEA5767_SEARCH_STATUS_BAND_LIMIT = 0x03,        /**< band limit reached */
+    TEA5767_SEARCH_STATUS_TIMEOUT    = 0x04,        /**< search timeout */
+} tea5767_search_status_t;
+
+/**
+ * @brief tea5767 scan mode enumeration definition
+ */
+typedef enum
+{
+    TEA5767_SCAN_MODE_SEARCH = 0x00,        /**< chained hardware search */
+    TEA5767_SCAN_MODE_SWEEP  = 0x01,        /**< stepped pll sweep */
+} tea5767_scan_mode_t;
+
+/**
+ * @brief tea5767 scan status enumeration definition
+ */
+typedef enum
+{
+    TEA5767_SCAN_STATUS_IDLE  = 0x00,        /**< no scan */
+    TEA5767_SCAN_STATUS_BUSY  = 0x01,        /**< scanning */
+    TEA5767_SCAN_STATUS_DONE  = 0x02,        /**< scan done */
+    TEA5767_SCAN_STATUS_ERROR = 0x03,        /**< scan failed */
+} tea5767_scan_status_t;
+
+/**
+ * @brief tea5767 station structure definition
+ */
+typedef struct tea5767_station_s
+{
+    uint16_t pll;                         /**< pll */
+    uint32_t khz;                         /**< frequency in KHz */
+    float mhz;                            /**< frequency in MHz, derived from khz */
+    uint8_t level;                        /**< level adc output */
+    uint8_t if_out;                       /**< if counter output */
+    tea5767_reception_t reception;        /**< reception */
+} tea5767_station_t;
+
+/**
+ * @brief tea5767 status structure definition
+ */
+typedef struct tea5767_status_s
+{
+    uint32_t khz;                         /**< frequency of the searched pll in KHz, 0 if out of range */
+    uint16_t pll;                         /**< searched pll */
+    uint8_t level;                        /**< level adc output */
+    uint8_t if_out;                       /**< if counter output */
+    tea5767_bool_t ready;                 /**< ready flag */
+    tea5767_bool_t band_limit;            /**< band limit flag */
+    tea5767_reception_t reception;        /**< reception */
+} tea5767_status_t;
+
+/**
+ * @brief tea5767 handle structure declaration
+ */
+struct tea5767_handle_s;
+
+/**
+ * @brief tea5767 scan context structure definition
+ */
+typedef struct tea5767_scan_s
+{
+    tea5767_station_t *station;                                                /**< station table */
+    uint16_t len;                                                              /**< station table length */
+    uint16_t num;                                                              /**< found station number */
+    uint16_t pll;                                                              /**< tuned pll */
+    uint16_t searched_pll;                                                     /**< last searched pll */
+    uint16_t step;                                                             /**< pll step of one raster */
+    uint32_t khz;                                                              /**< tuned frequency */
+    uint32_t min_khz;                                                          /**< band min */
+    uint32_t max_khz;                                                          /**< band max */
+    uint32_t tune_ms;                                                          /**< tune start timestamp */
+    uint32_t next_ms;                                                          /**< next poll timestamp */
+    uint8_t mode;                                                              /**< scan mode */
+    uint8_t status;                                                            /**< scan status */
+    uint8_t phase;                                                             /**< search or tune phase */
+    uint8_t stop;                                                              /**< search stop level */
+    uint8_t conf[5];                                                           /**< saved conf up */
+    void (*callback)(struct tea5767_handle_s *handle,
+                     tea5767_search_status_t status, uint16_t pll);            /**< saved search callback */
+} tea5767_scan_t;
+
+/**
+ * @brief tea5767 trace direction enumeration definition
+ */
+typedef enum
+{
+    TEA5767_TRACE_DIR_READ       = 0x00,        /**< read transfer */
+    TEA5767_TRACE_DIR_WRITE      = 0x01,        /**< write transfer */
+    TEA5767_TRACE_DIR_WRITE_READ = 0x02,        /**< write read transaction */
+} tea5767_trace_dir_t;
+
+/**
+ * @brief tea5767 trace record structure definition
+ */
+typedef struct tea5767_trace_record_s
+{
+    uint32_t timestamp_us;                         /**< transfer start time in us */
+    uint32_t latency_us;                           /**< transfer time in us */
+    uint8_t dir;                                   /**< tea5767_trace_dir_t */
+    uint8_t res;                                   /**< bus result */
+    uint8_t wlen;                                  /**< written length */
+    uint8_t rlen;                                  /**< read length */
+    uint8_t data[TEA5767_TRACE_DATA_SIZE];         /**< written bytes followed by read bytes */
+} tea5767_trace_record_t;
+
+/**
+ * @brief tea5767 trace structure definition
+ */
+typedef struct tea5767_trace_s
+{
+    uint32_t (*clock_us)(void);                 /**< point to a clock_us function address */
+    tea5767_trace_record_t *record;             /**< preallocated record ring */
+    uint32_t size;                              /**< record ring size, a power of 2 */
+    uint32_t head;                              /**< recorded transfer number */
+} tea5767_trace_t;
+
+/**
+ * @brief tea5767 stats operation enumeration definition
+ */
+typedef enum
+{
+    TEA5767_STATS_OP_IIC_READ        = 0x00,        /**< raw iic read */
+    TEA5767_STATS_OP_IIC_WRITE       = 0x01,        /**< raw iic write */
+    TEA5767_STATS_OP_IIC_WRITE_READ  = 0x02,        /**< raw iic write read transaction */
+    TEA5767_STATS_OP_WRITE_CONF      = 0x03,        /**< tea5767_write_conf */
+    TEA5767_STATS_OP_READ_CONF       = 0x04,        /**< tea5767_read_conf */
+    TEA5767_STATS_OP_WRITE_READ_CONF = 0x05,        /**< tea5767_write_read_conf */
+    TEA5767_STATS_OP_READ_STATUS     = 0x06,        /**< tea5767_read_status */
+    TEA5767_STATS_OP_SEARCH          = 0x07,        /**< search from start to finish */
+} tea5767_stats_op_t;
+
+/**
+ * @brief tea5767 stats counter structure definition
+ */
+typedef struct tea5767_stats_counter_s
+{
+    uint32_t count;                                     /**< calls */
+    uint32_t fail;                                      /**< failed calls */
+    uint32_t min_us;                                    /**< min latency in us */
+    uint32_t max_us;                                    /**< max latency in us */
+    uint64_t total_us;                                  /**< latency sum in us */
+    uint32_t bucket[TEA5767_STATS_BUCKET_NUM];          /**< bucket n counts 2^n to 2^(n+1) - 1us, bucket 0 counts 0us too */
+} tea5767_stats_counter_t;
+
+/**
+ * @brief tea5767 stats structure definition
+ */
+typedef struct tea5767_stats_s
+{
+    uint32_t (*clock_us)(void);                                     /**< point to a clock_us function address */
+    tea5767_stats_counter_t counter[TEA5767_STATS_OP_NUM];          /**< counters of all operations */
+} tea5767_stats_t;
+
+/**
+ * @brief tea5767 async status enumeration definition
+ */
+typedef enum
+{
+    TEA5767_ASYNC_STATUS_IDLE   = 0x00,        /**< nothing submitted */
+    TEA5767_ASYNC_STATUS_BUSY   = 0x01,        /**< transfer in flight */
+    TEA5767_ASYNC_STATUS_DONE   = 0x02,        /**< transfer completed */
+    TEA5767_ASYNC_STATUS_FAILED = 0x03,        /**< transfer failed */
+} tea5767_async_status_t;
+
+/**
+ * @brief tea5767 async operation enumeration definition
+ */
+typedef enum
+{
+    TEA5767_ASYNC_OP_WRITE_CONF = 0x00,        /**< tea5767_write_conf_async */
+    TEA5767_ASYNC_OP_READ_CONF  = 0x01,        /**< tea5767_read_conf_async */
+} tea5767_async_op_t;
+
+/**
+ * @brief tea5767 async done function definition
+ * @note  the link layer calls it once for every accepted submit, res is 0 on success
+ */
+typedef void (*tea5767_async_done_t)(void *arg, uint8_t res);
+
+/**
+ * @brief tea5767 task status enumeration definition
+ */
+typedef enum
+{
+    TEA5767_TASK_STATUS_IDLE  = 0x00,        /**< task is not started */
+    TEA5767_TASK_STATUS_BUSY  = 0x01,        /**< task is waiting */
+    TEA5767_TASK_STATUS_DONE  = 0x02,        /**< task finished */
+    TEA5767_TASK_STATUS_ERROR = 0x03,        /**< task failed */
+} tea5767_task_status_t;
+
+/**
+ * @brief tea5767 task structure definition
+ * @note  the step function is a protothread, it keeps its state in the task because locals are lost on every yield
+ */
+typedef struct tea5767_task_s
+{
+    uint8_t (*step)(struct tea5767_task_s *task, uint32_t ms);        /**< step function, returns a tea5767_task_status_t */
+    void *arg;                                                        /**< step argument, the handle of the driver tasks */
+    uint32_t wake_ms;                                                 /**< timestamp of the next step */
+    uint32_t start_ms;                                                /**< wait start timestamp */
+    uint16_t line;                                                    /**< resume point, 0 is the start */
+    uint8_t status;                                                   /**< tea5767_task_status_t */
+    uint8_t res;                                                      /**< status code of the finished operation */
+    tea5767_task_status_t child;                                      /**< status of the awaited task */
+    uint8_t mode;                                                     /**< search or scan mode */
+    uint8_t i;                                                        /**< loop counter */
+    uint8_t level[3];                                                 /**< image level of both side injections and the tuned level */
+    uint16_t pll[4];                                                  /**< pll of both images and both tunes, low side first */
+    uint8_t if_out;                                                   /**< if counter output */
+    uint8_t side;                                                     /**< chosen side injection */
+    uint16_t num;                                                     /**< found station number */
+    tea5767_station_t *station;                                       /**< station table */
+    uint16_t len;                                                     /**< station table length */
+} tea5767_task_t;
+
+/**
+ * @brief     begin the body of a task step function
+ * @param[in] TASK pointer to a tea5767 task structure
+ * @note      the body must end with TEA5767_TASK_END and must not use switch around a yield,
+ *            only one yield macro may be placed on a line
+ */
+#define TEA5767_TASK_BEGIN(TASK)            switch ((TASK)->line) { case 0:
+
+/**
+ * @brief     yield until a timestamp
+ * @param[in] TASK pointer to a tea5767 task structure
+ * @param[in] WAKE timestamp of the next step
+ * @note      the step resumes after the macro on the first call at or after WAKE
+ */
+#define TEA5767_TASK_WAIT_UNTIL(TASK, WAKE)                                     \
+    do                                                                          \
+    {                                                                           \
+        (TASK)->wake_ms = (WAKE);                                               \
+        (TASK)->line = (uint16_t)__LINE__;                                      \
+        return TEA5767_TASK_STATUS_BUSY;                                        \
+        case __LINE__:;                                                         \
+    } while (0)
+
+/**
+ * @brief     yield for a delay
+ * @param[in] TASK pointer to a tea5767 task structure
+ * @param[in] MS current timestamp in ms
+ * @param[in] DELAY delay in ms
+ * @note      replaces a blocking delay_ms in a task
+ */
+#define TEA5767_TASK_SLEEP(TASK, MS, DELAY)     TEA5767_TASK_WAIT_UNTIL(TASK, (MS) + (DELAY))
+
+/**
+ * @brief     run a child task until it finishes
+ * @param[in] TASK pointer to a tea5767 task structure
+ * @param[in] CHILD pointer to a prepared child task structure
+ * @param[in] MS current timestamp in ms
+ * @note      the parent yields once with a due wake time and the child runs from the next step,
+ *            so no case label is reached by falling through,
+ *            the parent sleeps as long as the child, the child status is saved in TASK->child
+ */
+#define TEA5767_TASK_AWAIT(TASK, CHILD, MS)                                     \
+    do                                                                          \
+    {                                                                           \
+        TEA5767_TASK_WAIT_UNTIL(TASK, MS);                                      \
+        (void)tea5767_task_step((CHILD), (MS), &(TASK)->child);                 \
+        if ((TASK)->child == TEA5767_TASK_STATUS_BUSY)                          \
+        {                                                                       \
+            (TASK)->wake_ms = (CHILD)->wake_ms;                                 \
+            return TEA5767_TASK_STATUS_BUSY;                                    \
+        }                                                                       \
+    } while (0)
+
+/**
+ * @brief     finish a task
+ * @param[in] TASK pointer to a tea5767 task structure
+ * @param[in] RES status code of the operation
+ * @note      0 finishes with TEA5767_TASK_STATUS_DONE, others with TEA5767_TASK_STATUS_ERROR
+ */
+#define TEA5767_TASK_EXIT(TASK, RES)                                            \
+    do                                                                          \
+    {                                                                           \
+        (TASK)->res = (RES);                                                    \
+        (TASK)->line = 0;                                                       \
+        return ((TASK)->res != 0) ? TEA5767_TASK_STATUS_ERROR :                 \
+                                    TEA5767_TASK_STATUS_DONE;                   \
+    } while (0)
+
+/**
+ * @brief     end the body of a task step function
+ * @param[in] TASK pointer to a tea5767 task structure
+ * @note      falling through the end finishes the task with status code 0
+ */
+#define TEA5767_TASK_END(TASK)              } TEA5767_TASK_EXIT(TASK, 0)
+
 /**
  * @brief tea5767 handle structure definition
  */
@@ -166,11 +536,42 @@ typedef struct tea5767_handle_s
     uint8_t (*iic_deinit)(void);                                               /**< point to an iic_deinit function address */
     uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);         /**< point to an iic_read_cmd function address */
     uint8_t (*iic_write_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);        /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_ctx_cmd)(void *ctx, uint8_t addr,
+                                uint8_t *buf, uint16_t len);                   /**< point to an iic_read_ctx_cmd function address */
+    uint8_t (*iic_write_ctx_cmd)(void *ctx, uint8_t addr,
+                                 uint8_t *buf, uint16_t len);                  /**< point to an iic_write_ctx_cmd function address */
+    void *bus_ctx;                                                             /**< bus context of the iic ctx commands */
+    uint8_t (*iic_write_read_cmd)(uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                  uint8_t *rbuf, uint16_t rlen);               /**< point to an iic_write_read_cmd function address */
+    uint8_t (*iic_write_read_ctx_cmd)(void *ctx, uint8_t addr,
+                                      uint8_t *wbuf, uint16_t wlen,
+                                      uint8_t *rbuf, uint16_t rlen);           /**< point to an iic_write_read_ctx_cmd function address */
+    uint8_t (*iic_read_submit)(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                               tea5767_async_done_t done, void *arg);          /**< point to an iic_read_submit function address */
+    uint8_t (*iic_write_submit)(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len,
+                                tea5767_async_done_t done, void *arg);         /**< point to an iic_write_submit function address */
     void (*delay_ms)(uint32_t ms);                                             /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                           /**< point to a debug_print function address */
+    void (*search_callback)(struct tea5767_handle_s *handle,
+                            tea5767_search_status_t status, uint16_t pll);     /**< point to a search_callback function address */
+    void (*async_callback)(struct tea5767_handle_s *handle,
+                           tea5767_async_op_t op, uint8_t res);                /**< point to an async_callback function address */
     uint8_t inited;                                                            /**< inited flag */
     uint8_t conf_up[5];                                                        /**< chip conf up */
     uint8_t conf_down[5];                                                      /**< chip conf down */
+    uint8_t conf_shadow[5];                                                    /**< last written conf up */
+    uint8_t conf_dirty;                                                        /**< conf up dirty mask */
+    uint8_t search_status;                                                     /**< search status */
+    uint32_t search_start_ms;                                                  /**< search start timestamp */
+    uint32_t search_next_ms;                                                   /**< next search poll timestamp */
+    uint32_t search_interval_ms;                                               /**< search poll interval */
+    tea5767_scan_t scan;                                                       /**< scan context */
+    tea5767_trace_t *trace;                                                    /**< bus trace, NULL disables tracing */
+    tea5767_stats_t *stats;                                                    /**< operation stats, NULL disables the stats */
+    volatile uint8_t async_status;                                             /**< tea5767_async_status_t */
+    uint8_t async_op;                                                          /**< tea5767_async_op_t in flight */
+    uint8_t async_buf[5];                                                      /**< async conf transfer buffer */
+    uint32_t async_start;                                                      /**< async stats start time */
 } tea5767_handle_t;
 
 /**
@@ -240,6 +641,65 @@ typedef struct tea5767_info_s
  */
 #define DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(HANDLE, FUC)   (HANDLE)->iic_write_cmd = FUC
 
+/**
+ * @brief     link iic_read_ctx_cmd function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to an iic_read_ctx_cmd function address
+ * @note      the ctx command is used instead of iic_read_cmd when it is linked
+ */
+#define DRIVER_TEA5767_LINK_IIC_READ_CTX_COMMAND(HANDLE, FUC)     (HANDLE)->iic_read_ctx_cmd = FUC
+
+/**
+ * @brief     link iic_write_ctx_cmd function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to an iic_write_ctx_cmd function address
+ * @note      the ctx command is used instead of iic_write_cmd when it is linked
+ */
+#define DRIVER_TEA5767_LINK_IIC_WRITE_CTX_COMMAND(HANDLE, FUC)    (HANDLE)->iic_write_ctx_cmd = FUC
+
+/**
+ * @brief     link the bus context
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] CTX pointer to a bus context, e.g. a bus file and a mux channel
+ * @note      the bus context is passed to the iic ctx commands
+ */
+#define DRIVER_TEA5767_LINK_BUS_CTX(HANDLE, CTX)                  (HANDLE)->bus_ctx = CTX
+
+/**
+ * @brief     link iic_write_read_cmd function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to an iic_write_read_cmd function address
+ * @note      the write read command is optional and can be NULL,
+ *            it should send the write and the read as one bus transaction
+ */
+#define DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(HANDLE, FUC)       (HANDLE)->iic_write_read_cmd = FUC
+
+/**
+ * @brief     link iic_write_read_ctx_cmd function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to an iic_write_read_ctx_cmd function address
+ * @note      the ctx command is used instead of iic_write_read_cmd when it is linked
+ */
+#define DRIVER_TEA5767_LINK_IIC_WRITE_READ_CTX_COMMAND(HANDLE, FUC)   (HANDLE)->iic_write_read_ctx_cmd = FUC
+
+/**
+ * @brief     link iic_read_submit function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to an iic_read_submit function address
+ * @note      the submit command is optional and can be NULL,
+ *            it should start the read and return at once, then call done when the read finishes
+ */
+#define DRIVER_TEA5767_LINK_IIC_READ_SUBMIT(HANDLE, FUC)     (HANDLE)->iic_read_submit = FUC
+
+/**
+ * @brief     link iic_write_submit function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to an iic_write_submit function address
+ * @note      the submit command is optional and can be NULL,
+ *            it should start the write and return at once, then call done when the write finishes
+ */
+#define DRIVER_TEA5767_LINK_IIC_WRITE_SUBMIT(HANDLE, FUC)    (HANDLE)->iic_write_submit = FUC
+
 /**
  * @brief     link delay_ms function
  * @param[in] HANDLE pointer to a tea5767 handle structure
@@ -256,6 +716,39 @@ typedef struct tea5767_info_s
  */
 #define DRIVER_TEA5767_LINK_DEBUG_PRINT(HANDLE, FUC)         (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link search_callback function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to a search_callback function address
+ * @note      the search callback is optional and can be NULL
+ */
+#define DRIVER_TEA5767_LINK_SEARCH_CALLBACK(HANDLE, FUC)     (HANDLE)->search_callback = FUC
+
+/**
+ * @brief     link async_callback function
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] FUC pointer to an async_callback function address
+ * @note      the async callback is optional and can be NULL,
+ *            it runs in the completion context of the link layer and owns the handle until it returns
+ */
+#define DRIVER_TEA5767_LINK_ASYNC_CALLBACK(HANDLE, FUC)      (HANDLE)->async_callback = FUC
+
+/**
+ * @brief     link the bus trace
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] TRACE pointer to an initialized tea5767 trace structure
+ * @note      the trace is optional and can be NULL
+ */
+#define DRIVER_TEA5767_LINK_TRACE(HANDLE, TRACE)             (HANDLE)->trace = TRACE
+
+/**
+ * @brief     link the operation stats
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @param[in] STATS pointer to an initialized tea5767 stats structure
+ * @note      the stats are optional and can be NULL
+ */
+#define DRIVER_TEA5767_LINK_STATS(HANDLE, STATS)             (HANDLE)->stats = STATS
+
 /**
  * @}
  */
@@ -314,6 +807,19 @@ uint8_t tea5767_deinit(tea5767_handle_t *handle);
  */
 uint8_t tea5767_write_conf(tea5767_handle_t *handle);
 
+/**
+ * @brief     flush the changed conf
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      nothing is written when the conf equals the last written conf,
+ *            otherwise only the shortest prefix covering the changed bytes is written
+ */
+uint8_t tea5767_flush_conf(tea5767_handle_t *handle);
+
 /**
  * @brief     update the conf
  * @param[in] *handle pointer to a tea5767 handle structure
@@ -338,6 +844,281 @@ uint8_t tea5767_update_conf(tea5767_handle_t *handle, uint8_t conf[5]);
  */
 uint8_t tea5767_read_conf(tea5767_handle_t *handle);
 
+/**
+ * @brief     write the conf and read the conf back
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write read conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the write and the read go out as one bus transaction when iic_write_read_cmd is linked,
+ *            otherwise they are sent one after another
+ */
+uint8_t tea5767_write_read_conf(tea5767_handle_t *handle);
+
+/**
+ * @brief     start writing the conf without waiting
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_write_submit is NULL
+ *            - 5 async transfer is busy
+ * @note      the conf is copied when submitted, so it can be changed while the write is in flight,
+ *            the handle and its stats belong to the completion context until the transfer is handed back,
+ *            only the async callback or a tea5767_get_async_status that returns a status other than busy hands it back
+ */
+uint8_t tea5767_write_conf_async(tea5767_handle_t *handle);
+
+/**
+ * @brief     start reading the conf without waiting
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_submit is NULL
+ *            - 5 async transfer is busy
+ * @note      the read conf is copied to the handle when the read finishes,
+ *            the handle and its stats belong to the completion context until the transfer is handed back,
+ *            only the async callback or a tea5767_get_async_status that returns a status other than busy hands it back
+ */
+uint8_t tea5767_read_conf_async(tea5767_handle_t *handle);
+
+/**
+ * @brief      get the async transfer status
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *status pointer to an async status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a status other than busy hands the conf buffers and the stats back to the caller,
+ *             reading handle->async_status directly does not
+ */
+uint8_t tea5767_get_async_status(tea5767_handle_t *handle, tea5767_async_status_t *status);
+
+/**
+ * @brief     read the status prefix
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] nbytes read length
+ * @return    status code
+ *            - 0 success
+ *            - 1 read status failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 nbytes is invalid
+ * @note      1 <= nbytes <= 5, byte 0 holds ready, band limit and pll high,
+ *            byte 1 holds pll low, byte 2 holds stereo and if, byte 3 holds the level
+ */
+uint8_t tea5767_read_status(tea5767_handle_t *handle, uint8_t nbytes);
+
+/**
+ * @brief      read and decode all status fields
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *status pointer to a tea5767 status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read status failed
+ *             - 2 handle or status is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ * @note       one 4 bytes read, the frequency uses the local clock and side injection settings
+ */
+uint8_t tea5767_read_status_snapshot(tea5767_handle_t *handle, tea5767_status_t *status);
+
+#if (TEA5767_FAST_ACCESSORS != 0)
+
+/**
+ * @brief     check the handle of a fast accessor
+ * @param[in] HANDLE pointer to a tea5767 handle structure
+ * @note      compiled out when NDEBUG is defined
+ */
+#ifndef NDEBUG
+#define TEA5767_FAST_CHECK(HANDLE)                                              \
+    do {                                                                        \
+        if ((HANDLE) == NULL)                                                   \
+        {                                                                       \
+            return 2;                                                           \
+        }                                                                       \
+        if ((HANDLE)->inited != 1)                                              \
+        {                                                                       \
+            return 3;                                                           \
+        }                                                                       \
+    } while (0)
+#else
+#define TEA5767_FAST_CHECK(HANDLE)          do { (void)(HANDLE); } while (0)
+#endif
+
+/**
+ * @brief     define an inline getter of a register field
+ * @param[in] NAME accessor name suffix
+ * @param[in] TYPE field type
+ * @param[in] CONF conf_up or conf_down
+ * @param[in] BYTE byte index
+ * @param[in] SHIFT field shift
+ * @param[in] MASK field mask after the shift
+ * @note      none
+ */
+#define TEA5767_FAST_GETTER(NAME, TYPE, CONF, BYTE, SHIFT, MASK)                \
+    static inline uint8_t tea5767_get_##NAME(tea5767_handle_t *handle, TYPE *value) \
+    {                                                                           \
+        TEA5767_FAST_CHECK(handle);                                             \
+        *value = (TYPE)((handle->CONF[BYTE] >> (SHIFT)) & (MASK));              \
+                                                                                \
+        return 0;                                                               \
+    }
+
+/**
+ * @brief     define an inline setter and getter of a conf_up field
+ * @param[in] NAME accessor name suffix
+ * @param[in] TYPE field type
+ * @param[in] BYTE byte index
+ * @param[in] SHIFT field shift
+ * @param[in] MASK field mask after the shift
+ * @note      none
+ */
+#define TEA5767_FAST_FIELD(NAME, TYPE, BYTE, SHIFT, MASK)                       \
+    static inline uint8_t tea5767_set_##NAME(tea5767_handle_t *handle, TYPE value) \
+    {                                                                           \
+        TEA5767_FAST_CHECK(handle);                                             \
+        handle->conf_up[BYTE] = (uint8_t)((handle->conf_up[BYTE] & ~((MASK) << (SHIFT))) | \
+                                          (((uint32_t)value & (MASK)) << (SHIFT))); \
+                                                                                \
+        return 0;                                                               \
+    }                                                                           \
+    TEA5767_FAST_GETTER(NAME, TYPE, conf_up, BYTE, SHIFT, MASK)
+
+TEA5767_FAST_FIELD(mute, tea5767_bool_t, 0, 7, 0x01)
+TEA5767_FAST_FIELD(mode, tea5767_mode_t, 0, 6, 0x01)
+TEA5767_FAST_FIELD(search_mode, tea5767_search_mode_t, 2, 7, 0x01)
+TEA5767_FAST_FIELD(search_stop_level, tea5767_search_stop_level_t, 2, 5, 0x03)
+TEA5767_FAST_FIELD(side_injection, tea5767_side_injection_t, 2, 4, 0x01)
+TEA5767_FAST_FIELD(channel, tea5767_channel_t, 2, 3, 0x01)
+TEA5767_FAST_FIELD(right_mute, tea5767_bool_t, 2, 2, 0x01)
+TEA5767_FAST_FIELD(left_mute, tea5767_bool_t, 2, 1, 0x01)
+TEA5767_FAST_FIELD(port1, tea5767_level_t, 2, 0, 0x01)
+TEA5767_FAST_FIELD(port2, tea5767_level_t, 3, 7, 0x01)
+TEA5767_FAST_FIELD(standby, tea5767_bool_t, 3, 6, 0x01)
+TEA5767_FAST_FIELD(band, tea5767_band_t, 3, 5, 0x01)
+TEA5767_FAST_FIELD(soft_mute, tea5767_bool_t, 3, 3, 0x01)
+TEA5767_FAST_FIELD(high_cut_control, tea5767_bool_t, 3, 2, 0x01)
+TEA5767_FAST_FIELD(stereo_noise_cancelling, tea5767_bool_t, 3, 1, 0x01)
+TEA5767_FAST_FIELD(port1_as_search_indicator, tea5767_bool_t, 3, 0, 0x01)
+TEA5767_FAST_FIELD(de_emphasis, tea5767_de_emphasis_t, 4, 6, 0x01)
+TEA5767_FAST_GETTER(ready_flag, tea5767_bool_t, conf_down, 0, 7, 0x01)
+TEA5767_FAST_GETTER(band_limit_flag, tea5767_bool_t, conf_down, 0, 6, 0x01)
+TEA5767_FAST_GETTER(if, uint8_t, conf_down, 2, 0, 0x7F)
+TEA5767_FAST_GETTER(reception, tea5767_reception_t, conf_down, 2, 7, 0x01)
+TEA5767_FAST_GETTER(level_adc_output, uint8_t, conf_down, 3, 4, 0x0F)
+
+/**
+ * @brief     inline set the pll
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] pll set pll
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 pll > 0x3FFF
+ * @note      the range check is compiled out when NDEBUG is defined
+ */
+static inline uint8_t tea5767_set_pll(tea5767_handle_t *handle, uint16_t pll)
+{
+    TEA5767_FAST_CHECK(handle);
+#ifndef NDEBUG
+    if (pll > 0x3FFF)
+    {
+        handle->debug_print("tea5767: pll > 0x3FFF.\n");
+        
+        return 4;
+    }
+#endif
+    handle->conf_up[0] = (uint8_t)((handle->conf_up[0] & ~0x3F) | ((pll >> 8) & 0x3F));
+    handle->conf_up[1] = (uint8_t)(pll & 0xFF);
+    
+    return 0;
+}
+
+/**
+ * @brief      inline get the pll
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *pll pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+static inline uint8_t tea5767_get_pll(tea5767_handle_t *handle, uint16_t *pll)
+{
+    TEA5767_FAST_CHECK(handle);
+    *pll = (uint16_t)(((uint16_t)(handle->conf_up[0] & 0x3F) << 8) | handle->conf_up[1]);
+    
+    return 0;
+}
+
+/**
+ * @brief     inline set the clock
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] clk chip clock
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+static inline uint8_t tea5767_set_clock(tea5767_handle_t *handle, tea5767_clock_t clk)
+{
+    TEA5767_FAST_CHECK(handle);
+    handle->conf_up[3] = (uint8_t)((handle->conf_up[3] & ~(1 << 4)) | (((clk >> 0) & 0x01) << 4));
+    handle->conf_up[4] = (uint8_t)((handle->conf_up[4] & ~(1 << 7)) | (((clk >> 1) & 0x01) << 7));
+    
+    return 0;
+}
+
+/**
+ * @brief      inline get the clock
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *clk pointer to a chip clock buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+static inline uint8_t tea5767_get_clock(tea5767_handle_t *handle, tea5767_clock_t *clk)
+{
+    TEA5767_FAST_CHECK(handle);
+    *clk = (tea5767_clock_t)((((handle->conf_up[4] >> 7) & 0x01) << 1) | ((handle->conf_up[3] >> 4) & 0x01));
+    
+    return 0;
+}
+
+/**
+ * @brief      inline get the searched pll
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *pll pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reads the cached status, refresh it by tea5767_read_conf
+ */
+static inline uint8_t tea5767_get_searched_pll(tea5767_handle_t *handle, uint16_t *pll)
+{
+    TEA5767_FAST_CHECK(handle);
+    *pll = (uint16_t)(((uint16_t)(handle->conf_down[0] & 0x3F) << 8) | handle->conf_down[1]);
+    
+    return 0;
+}
+
+#endif
+
 /**
  * @brief     enable or disable the mute
  * @param[in] *handle pointer to a tea5767 handle structure
@@ -868,6 +1649,84 @@ uint8_t tea5767_get_reception(tea5767_handle_t *handle, tea5767_reception_t *rec
  */
 uint8_t tea5767_get_level_adc_output(tea5767_handle_t *handle, uint8_t *output);
 
+/**
+ * @brief      read the ready flag from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 1 byte of the conf down is read
+ */
+uint8_t tea5767_read_ready_flag(tea5767_handle_t *handle, tea5767_bool_t *enable);
+
+/**
+ * @brief      read the band limit flag from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 1 byte of the conf down is read
+ */
+uint8_t tea5767_read_band_limit_flag(tea5767_handle_t *handle, tea5767_bool_t *enable);
+
+/**
+ * @brief      read the searched pll from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *pll pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 2 bytes of the conf down are read
+ */
+uint8_t tea5767_read_searched_pll(tea5767_handle_t *handle, uint16_t *pll);
+
+/**
+ * @brief      read the if from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *if_out pointer to an if out buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 3 bytes of the conf down are read
+ */
+uint8_t tea5767_read_if(tea5767_handle_t *handle, uint8_t *if_out);
+
+/**
+ * @brief      read the reception from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *reception pointer to a reception buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 3 bytes of the conf down are read
+ */
+uint8_t tea5767_read_reception(tea5767_handle_t *handle, tea5767_reception_t *reception);
+
+/**
+ * @brief      read the level adc output from the chip
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *output pointer to a level adc output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the first 4 bytes of the conf down are read
+ */
+uint8_t tea5767_read_level_adc_output(tea5767_handle_t *handle, uint8_t *output);
+
 /**
  * @brief      convert the frequency to the register raw data
  * @param[in]  *handle pointer to a tea5767 handle structure
@@ -896,6 +1755,286 @@ uint8_t tea5767_frequency_convert_to_register(tea5767_handle_t *handle, float mh
  */
 uint8_t tea5767_frequency_convert_to_data(tea5767_handle_t *handle, uint16_t pll, float *mhz);
 
+/**
+ * @brief      convert the frequency in KHz to the pll
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  khz radio frequency in KHz
+ * @param[out] *pll pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 khz is out of range
+ * @note       integer only, pll is the exact floor of 4 * (khz +/- 225) / clock in KHz
+ */
+uint8_t tea5767_khz_to_pll(tea5767_handle_t *handle, uint32_t khz, uint16_t *pll);
+
+/**
+ * @brief      convert the pll to the frequency in KHz
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  pll register raw data
+ * @param[out] *khz pointer to a frequency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 pll is out of range
+ * @note       integer only, returns the lowest frequency that tea5767_khz_to_pll maps back to the same pll
+ */
+uint8_t tea5767_pll_to_khz(tea5767_handle_t *handle, uint16_t pll, uint32_t *khz);
+
+/**
+ * @brief     tune to a channel of the raster
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] index channel index from the band min
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 index is over the band
+ *            - 5 channel table is stripped
+ * @note      the table is selected by the local band, clock and side injection,
+ *            the pll is loaded from the table and only the changed conf prefix is written
+ */
+uint8_t tea5767_set_channel_index(tea5767_handle_t *handle, uint16_t index);
+
+/**
+ * @brief     start a non-blocking search
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] mode search mode
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the search starts from the local pll, advance it by tea5767_search_poll
+ */
+uint8_t tea5767_search_start(tea5767_handle_t *handle, tea5767_search_mode_t mode, uint32_t ms);
+
+/**
+ * @brief      poll the non-blocking search
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *status pointer to a search status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read conf failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function never sleeps and only touches the bus when the poll interval has elapsed,
+ *             the poll interval starts after the pll settling time and doubles up to a limit,
+ *             when the search finishes the searched pll is saved in local, the mode is set back to normal
+ *             and the search callback is called
+ */
+uint8_t tea5767_search_poll(tea5767_handle_t *handle, uint32_t ms, tea5767_search_status_t *status);
+
+/**
+ * @brief     stop the non-blocking search
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the chip is tuned back to the local pll
+ */
+uint8_t tea5767_search_stop(tea5767_handle_t *handle);
+
+/**
+ * @brief      scan the whole band
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  mode scan mode
+ * @param[out] *station pointer to a station table
+ * @param[in]  len station table length
+ * @param[out] *num pointer to a found station number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the band and the search stop level are taken from the local conf,
+ *             stations are aligned to the 100KHz raster and kept only when the if counter is in 0x31 - 0x3E,
+ *             the scan stops when the table is full and the local conf is written back at the end
+ */
+uint8_t tea5767_scan(tea5767_handle_t *handle, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint16_t *num);
+
+/**
+ * @brief     start a non-blocking scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] mode scan mode
+ * @param[in] *station pointer to a station table
+ * @param[in] len station table length
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 scan start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 scan or search is busy
+ * @note      the station table must stay valid until the scan is done, advance it by tea5767_scan_poll,
+ *            a running scan or search must finish or be stopped before a new scan starts
+ */
+uint8_t tea5767_scan_start(tea5767_handle_t *handle, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint32_t ms);
+
+/**
+ * @brief      poll the non-blocking scan
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *status pointer to a scan status buffer
+ * @param[out] *num pointer to a found station number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function never sleeps and only touches the bus when a step is due,
+ *             a bus error ends the scan with TEA5767_SCAN_STATUS_ERROR
+ */
+uint8_t tea5767_scan_poll(tea5767_handle_t *handle, uint32_t ms, tea5767_scan_status_t *status, uint16_t *num);
+
+/**
+ * @brief     stop the non-blocking scan
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a running scan ends with TEA5767_SCAN_STATUS_DONE, the local conf is restored
+ *            and the stations found so far are kept
+ */
+uint8_t tea5767_scan_stop(tea5767_handle_t *handle);
+
+/**
+ * @brief      fine tune the pll by the if counter
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[out] *if_out pointer to an if counter output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 afc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 no carrier
+ *             - 6 afc is not converged
+ * @note       call it after a preset tune or a search, the if counter is moved into 0x31 - 0x3E,
+ *             every correction is predicted from the if offset and costs one pll write and one 3 bytes read,
+ *             a tuned station needs only the first read,
+ *             this function runs the afc task with blocking delays
+ */
+uint8_t tea5767_afc(tea5767_handle_t *handle, uint8_t *if_out);
+
+/**
+ * @brief      tune a frequency with the cleaner side injection
+ * @param[in]  *handle pointer to a tea5767 handle structure
+ * @param[in]  khz radio frequency in KHz
+ * @param[out] *side pointer to a chosen side injection buffer
+ * @param[out] *level pointer to a level adc output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 tune optimal failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 clock is invalid
+ *             - 5 khz is out of range
+ * @note       the datasheet procedure, the level is measured at f + 450KHz with the high side injection
+ *             and at f - 450KHz with the low side injection, the side with the lower image level wins,
+ *             the high side level is read in the same transaction as the low side write,
+ *             the chip is left tuned with the chosen side, the local conf follows it and level is the tuned level,
+ *             this function runs the tune optimal task with blocking delays
+ */
+uint8_t tea5767_tune_optimal(tea5767_handle_t *handle, uint32_t khz, tea5767_side_injection_t *side, uint8_t *level);
+
+/**
+ * @brief     prepare a task
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] *step pointer to a step function address
+ * @param[in] *arg pointer to the step argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 task is NULL
+ *            - 4 step is NULL
+ * @note      the first step runs on the next tea5767_task_step call
+ */
+uint8_t tea5767_task_init(tea5767_task_t *task, uint8_t (*step)(tea5767_task_t *task, uint32_t ms), void *arg);
+
+/**
+ * @brief      run one step of a task
+ * @param[in]  *task pointer to a tea5767 task structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *status pointer to a task status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 task is NULL
+ *             - 4 task is not prepared
+ * @note       this function never sleeps, the step function only runs when the task is busy and its wake time is due
+ */
+uint8_t tea5767_task_step(tea5767_task_t *task, uint32_t ms, tea5767_task_status_t *status);
+
+/**
+ * @brief     prepare a search task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] mode search mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ * @note      the task runs tea5767_search_start and tea5767_search_poll and yields between the polls,
+ *            the task result is 0 for a found station, 1 for a failed search and 4 for the band limit
+ */
+uint8_t tea5767_search_task(tea5767_handle_t *handle, tea5767_task_t *task, tea5767_search_mode_t mode);
+
+/**
+ * @brief     prepare a scan task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] mode scan mode
+ * @param[in] *station pointer to a station table
+ * @param[in] len station table length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ * @note      the task runs tea5767_scan_start and tea5767_scan_poll and yields between the steps,
+ *            the found station number is saved in task->num
+ */
+uint8_t tea5767_scan_task(tea5767_handle_t *handle, tea5767_task_t *task, tea5767_scan_mode_t mode,
+                          tea5767_station_t *station, uint16_t len);
+
+/**
+ * @brief     prepare an afc task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ *            - 4 clock is invalid
+ * @note      the task result is the status code of tea5767_afc and the if counter is saved in task->if_out
+ */
+uint8_t tea5767_afc_task(tea5767_handle_t *handle, tea5767_task_t *task);
+
+/**
+ * @brief     prepare a tune optimal task
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] khz radio frequency in KHz
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or task is NULL
+ *            - 3 handle is not initialized
+ *            - 4 clock is invalid
+ *            - 5 khz is out of range
+ * @note      all pll words are precomputed here, the task result is the status code of tea5767_tune_optimal,
+ *            the image levels are saved in task->level[0] and task->level[1] by side injection,
+ *            the chosen side is saved in task->side and the tuned level in task->level[2]
+ */
+uint8_t tea5767_tune_optimal_task(tea5767_handle_t *handle, tea5767_task_t *task, uint32_t khz);
+
 /**
  * @}
  */
@@ -0,0 +1,472 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767.hpp
+ * @brief     driver tea5767 c++ header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_HPP
+#define DRIVER_TEA5767_HPP
+
+#include "driver_tea5767.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @defgroup tea5767_cpp_driver tea5767 c++ driver function
+ * @brief    tea5767 header only c++17 driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+namespace tea5767
+{
+
+/**
+ * @brief tea5767 register definition
+ */
+constexpr std::uint8_t address = 0xC0;        /**< iic device address */
+constexpr std::size_t conf_size = 5;          /**< conf length in bytes */
+
+/**
+ * @brief  tea5767 register field part definition
+ * @tparam Byte conf byte index
+ * @tparam Shift lsb position in the byte
+ * @tparam Width bit width
+ * @tparam Offset lsb position in the field value
+ * @note   a field that spans bytes is built from several parts
+ */
+template <std::uint8_t Byte, std::uint8_t Shift, std::uint8_t Width, std::uint8_t Offset = 0>
+struct part
+{
+    static_assert(Byte < conf_size, "byte is out of the conf");
+    static_assert((Width >= 1) && ((Shift + Width) <= 8), "part must fit in one byte");
+    
+    static constexpr std::uint8_t mask = static_cast<std::uint8_t>(((1u << Width) - 1u) << Shift);        /**< byte mask */
+    
+    /**
+     * @brief     get the mask of a byte
+     * @param[in] b byte index
+     * @return    byte mask
+     * @note      none
+     */
+    static constexpr std::uint8_t mask_of(std::size_t b) noexcept
+    {
+        return (b == Byte) ? mask : 0;
+    }
+    
+    /**
+     * @brief     get the bits of a byte
+     * @param[in] b byte index
+     * @param[in] v field value
+     * @return    shifted bits
+     * @note      none
+     */
+    static constexpr std::uint8_t bits_of(std::size_t b, std::uint32_t v) noexcept
+    {
+        return (b == Byte) ? static_cast<std::uint8_t>(((v >> Offset) << Shift) & mask) : 0;
+    }
+    
+    /**
+     * @brief     extract the part from a conf
+     * @param[in] *conf pointer to a conf buffer
+     * @return    part bits at the field position
+     * @note      none
+     */
+    static constexpr std::uint32_t extract(const std::uint8_t *conf) noexcept
+    {
+        return static_cast<std::uint32_t>((conf[Byte] & mask) >> Shift) << Offset;
+    }
+};
+
+/**
+ * @brief  tea5767 register field definition
+ * @tparam T value type
+ * @tparam P parts of the field
+ * @note   none
+ */
+template <typename T, typename... P>
+struct field
+{
+    using value_type = T;        /**< value type */
+    
+    /**
+     * @brief     get the mask of a byte
+     * @param[in] b byte index
+     * @return    byte mask
+     * @note      none
+     */
+    static constexpr std::uint8_t mask_of(std::size_t b) noexcept
+    {
+        return static_cast<std::uint8_t>((0u | ... | P::mask_of(b)));
+    }
+    
+    /**
+     * @brief     get the bits of a byte
+     * @param[in] b byte index
+     * @param[in] v field value
+     * @return    shifted bits
+     * @note      none
+     */
+    static constexpr std::uint8_t bits_of(std::size_t b, T v) noexcept
+    {
+        return static_cast<std::uint8_t>((0u | ... | P::bits_of(b, static_cast<std::uint32_t>(v))));
+    }
+    
+    /**
+     * @brief     extract the field from a conf
+     * @param[in] *conf pointer to a conf buffer
+     * @return    field value
+     * @note      none
+     */
+    static constexpr T extract(const std::uint8_t *conf) noexcept
+    {
+        return static_cast<T>((0u | ... | P::extract(conf)));
+    }
+};
+
+/**
+ * @brief tea5767 written register map definition
+ */
+namespace conf_up
+{
+using mute                      = field<tea5767_bool_t, part<0, 7, 1>>;                               /**< mute */
+using mode                      = field<tea5767_mode_t, part<0, 6, 1>>;                               /**< search mode enable */
+using pll                       = field<std::uint16_t, part<0, 0, 6, 8>, part<1, 0, 8>>;              /**< pll */
+using search_mode               = field<tea5767_search_mode_t, part<2, 7, 1>>;                        /**< search direction */
+using search_stop_level         = field<tea5767_search_stop_level_t, part<2, 5, 2>>;                  /**< search stop level */
+using side_injection            = field<tea5767_side_injection_t, part<2, 4, 1>>;                     /**< side injection */
+using channel                   = field<tea5767_channel_t, part<2, 3, 1>>;                            /**< mono or stereo */
+using right_mute                = field<tea5767_bool_t, part<2, 2, 1>>;                               /**< right mute */
+using left_mute                 = field<tea5767_bool_t, part<2, 1, 1>>;                               /**< left mute */
+using port1                     = field<tea5767_level_t, part<2, 0, 1>>;                              /**< port 1 */
+using port2                     = field<tea5767_level_t, part<3, 7, 1>>;                              /**< port 2 */
+using standby                   = field<tea5767_bool_t, part<3, 6, 1>>;                               /**< standby */
+using band                      = field<tea5767_band_t, part<3, 5, 1>>;                               /**< band */
+using clock                     = field<tea5767_clock_t, part<3, 4, 1, 0>, part<4, 7, 1, 1>>;         /**< xtal and pllref */
+using soft_mute                 = field<tea5767_bool_t, part<3, 3, 1>>;                               /**< soft mute */
+using high_cut_control          = field<tea5767_bool_t, part<3, 2, 1>>;                               /**< high cut control */
+using stereo_noise_cancelling   = field<tea5767_bool_t, part<3, 1, 1>>;                               /**< stereo noise cancelling */
+using port1_as_search_indicator = field<tea5767_bool_t, part<3, 0, 1>>;                               /**< port 1 as search indicator */
+using de_emphasis               = field<tea5767_de_emphasis_t, part<4, 6, 1>>;                        /**< de-emphasis */
+}
+
+/**
+ * @brief tea5767 read register map definition
+ */
+namespace conf_down
+{
+using ready_flag                = field<tea5767_bool_t, part<0, 7, 1>>;                               /**< ready flag */
+using band_limit_flag           = field<tea5767_bool_t, part<0, 6, 1>>;                               /**< band limit flag */
+using searched_pll              = field<std::uint16_t, part<0, 0, 6, 8>, part<1, 0, 8>>;              /**< searched pll */
+using reception                 = field<tea5767_reception_t, part<2, 7, 1>>;                          /**< mono or stereo */
+using if_out                    = field<std::uint8_t, part<2, 0, 7>>;                                 /**< if counter */
+using level_adc_output          = field<std::uint8_t, part<3, 4, 4>>;                                 /**< level adc output */
+}
+
+/**
+ * @brief  tea5767 function transport definition
+ * @tparam Read iic read function address
+ * @tparam Write iic write function address
+ * @note   the bus functions are template arguments, so the calls are direct and can be inlined
+ */
+template <std::uint8_t (*Read)(std::uint8_t addr, std::uint8_t *buf, std::uint16_t len),
+          std::uint8_t (*Write)(std::uint8_t addr, std::uint8_t *buf, std::uint16_t len)>
+struct function_transport
+{
+    /**
+     * @brief     iic read
+     * @param[in] addr iic device write address
+     * @param[in] *buf pointer to a data buffer
+     * @param[in] len length of the data buffer
+     * @return    status code
+     *            - 0 success
+     *            - 1 read failed
+     * @note      none
+     */
+    std::uint8_t read(std::uint8_t addr, std::uint8_t *buf, std::uint16_t len) const noexcept
+    {
+        return Read(addr, buf, len);
+    }
+    
+    /**
+     * @brief     iic write
+     * @param[in] addr iic device write address
+     * @param[in] *buf pointer to a data buffer
+     * @param[in] len length of the data buffer
+     * @return    status code
+     *            - 0 success
+     *            - 1 write failed
+     * @note      none
+     */
+    std::uint8_t write(std::uint8_t addr, std::uint8_t *buf, std::uint16_t len) const noexcept
+    {
+        return Write(addr, buf, len);
+    }
+};
+
+/**
+ * @brief  tea5767 device definition
+ * @tparam Transport bus type with read(addr, buf, len) and write(addr, buf, len) members
+ * @note   the field setters only change the local conf, write it by flush_conf or write_conf
+ */
+template <typename Transport>
+class device
+{
+  public:
+    /**
+     * @brief     construct a device
+     * @param[in] transport bus object
+     * @note      the chip conf is unknown until the first write
+     */
+    explicit device(Transport transport = Transport()) noexcept : m_transport(transport)
+    {
+    }
+    
+    /**
+     * @brief     power up the chip with a known conf
+     * @param[in] clk chip crystal frequency
+     * @param[in] band radio band
+     * @param[in] pll pll word of the first station
+     * @return    status code
+     *            - 0 success
+     *            - 1 init failed
+     * @note      a default device starts from an all zero conf, which selects the 13MHz clock and no high cut control,
+     *            so the conf is cleared, the clock, band and pll are set with normal mode, mid search stop level,
+     *            stereo, high cut control and stereo noise cancelling, and the whole conf is sent as one 5 bytes write,
+     *            the cleared fields leave the chip unmuted, out of standby, on low side injection and 50us de-emphasis
+     */
+    std::uint8_t init(tea5767_clock_t clk, tea5767_band_t band, std::uint16_t pll) noexcept
+    {
+        for (std::uint8_t i = 0; i < conf_size; i++)
+        {
+            m_conf_up[i] = 0;
+        }
+        update<conf_up::mode, conf_up::pll, conf_up::search_stop_level, conf_up::channel, conf_up::band,
+               conf_up::clock, conf_up::high_cut_control, conf_up::stereo_noise_cancelling>(
+               TEA5767_MODE_NORMAL, pll, TEA5767_SEARCH_STOP_LEVEL_MID, TEA5767_CHANNEL_STEREO, band,
+               clk, TEA5767_BOOL_TRUE, TEA5767_BOOL_TRUE);
+        
+        return (write_conf() != 0) ? 1 : 0;
+    }
+    
+    /**
+     * @brief     set one field in the local conf
+     * @tparam    F register field
+     * @param[in] v field value
+     * @note      inlines to one read-modify-write of every touched byte
+     */
+    template <typename F>
+    void set(typename F::value_type v) noexcept
+    {
+        update<F>(v);
+    }
+    
+    /**
+     * @brief     set several fields in the local conf
+     * @tparam    F register fields
+     * @param[in] v field values in the order of the fields
+     * @note      the masks of every byte are composed at compile time, so each touched byte is written once
+     */
+    template <typename... F>
+    void update(typename F::value_type... v) noexcept
+    {
+        a_update<F...>(std::make_index_sequence<conf_size>(), v...);
+    }
+    
+    /**
+     * @brief  get a field of the local conf
+     * @tparam F written register field
+     * @return field value
+     * @note   none
+     */
+    template <typename F>
+    typename F::value_type get() const noexcept
+    {
+        return F::extract(m_conf_up);
+    }
+    
+    /**
+     * @brief  get a field of the last read status
+     * @tparam F read register field
+     * @return field value
+     * @note   none
+     */
+    template <typename F>
+    typename F::value_type status() const noexcept
+    {
+        return F::extract(m_conf_down);
+    }
+    
+    /**
+     * @brief  write the conf
+     * @return status code
+     *         - 0 success
+     *         - 1 write conf failed
+     * @note   none
+     */
+    std::uint8_t write_conf() noexcept
+    {
+        return a_write(static_cast<std::uint8_t>(conf_size));
+    }
+    
+    /**
+     * @brief  flush the changed conf
+     * @return status code
+     *         - 0 success
+     *         - 1 flush conf failed
+     * @note   only the shortest prefix covering the changed bytes is written
+     */
+    std::uint8_t flush_conf() noexcept
+    {
+        std::uint8_t len = 0;
+        
+        for (std::uint8_t i = 0; i < conf_size; i++)
+        {
+            if ((m_conf_up[i] != m_conf_shadow[i]) || (((m_dirty >> i) & 0x01) != 0))
+            {
+                len = static_cast<std::uint8_t>(i + 1);
+            }
+        }
+        if (len == 0)
+        {
+            return 0;
+        }
+        
+        return a_write(len);
+    }
+    
+    /**
+     * @brief     read the status prefix
+     * @param[in] nbytes read length
+     * @return    status code
+     *            - 0 success
+     *            - 1 read status failed
+     *            - 4 nbytes is invalid
+     * @note      1 <= nbytes <= 5
+     */
+    std::uint8_t read_status(std::uint8_t nbytes = conf_size) noexcept
+    {
+        if ((nbytes == 0) || (nbytes > conf_size))
+        {
+            return 4;
+        }
+        
+        return (m_transport.read(address, m_conf_down, nbytes) != 0) ? 1 : 0;
+    }
+    
+    /**
+     * @brief  get the local conf
+     * @return pointer to the conf up buffer
+     * @note   none
+     */
+    const std::uint8_t *conf() const noexcept
+    {
+        return m_conf_up;
+    }
+    
+  private:
+    /**
+     * @brief     set the fields of one byte
+     * @tparam    B byte index
+     * @tparam    F register fields
+     * @param[in] v field values
+     * @note      untouched bytes compile to nothing
+     */
+    template <std::size_t B, typename... F>
+    void a_update_byte(typename F::value_type... v) noexcept
+    {
+        constexpr std::uint8_t mask = static_cast<std::uint8_t>((0u | ... | F::mask_of(B)));
+        
+        static_assert((0u + ... + F::mask_of(B)) == mask, "fields overlap");
+        if constexpr (mask != 0)
+        {
+            m_conf_up[B] = static_cast<std::uint8_t>((m_conf_up[B] & static_cast<std::uint8_t>(~mask)) |
+                                                     (0u | ... | F::bits_of(B, v)));
+        }
+    }
+    
+    /**
+     * @brief     set the fields of all bytes
+     * @tparam    F register fields
+     * @tparam    B byte indexes
+     * @param[in] v field values
+     * @note      none
+     */
+    template <typename... F, std::size_t... B>
+    void a_update(std::index_sequence<B...>, typename F::value_type... v) noexcept
+    {
+        (a_update_byte<B, F...>(v...), ...);
+    }
+    
+    /**
+     * @brief     write the conf prefix and update the shadow
+     * @param[in] len conf prefix length
+     * @return    status code
+     *            - 0 success
+     *            - 1 write failed
+     * @note      none
+     */
+    std::uint8_t a_write(std::uint8_t len) noexcept
+    {
+        const std::uint8_t mask = static_cast<std::uint8_t>((1u << len) - 1u);
+        
+        if (m_transport.write(address, m_conf_up, len) != 0)
+        {
+            m_dirty |= mask;
+            
+            return 1;
+        }
+        for (std::uint8_t i = 0; i < len; i++)
+        {
+            m_conf_shadow[i] = m_conf_up[i];
+        }
+        m_dirty &= static_cast<std::uint8_t>(~mask);
+        
+        return 0;
+    }
+    
+    Transport m_transport;                       /**< bus */
+    std::uint8_t m_conf_up[conf_size] = {};      /**< chip conf up */
+    std::uint8_t m_conf_down[conf_size] = {};    /**< chip conf down */
+    std::uint8_t m_conf_shadow[conf_size] = {};  /**< last written conf up */
+    std::uint8_t m_dirty = 0x1F;                 /**< conf up dirty mask */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
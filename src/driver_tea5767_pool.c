@@ -0,0 +1,405 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_pool.c
+ * @brief     driver tea5767 pool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_pool.h"
+
+/**
+ * @brief  pool tuner iic init
+ * @return status code
+ *         - 0 success
+ * @note   the shared bus is opened by the pool owner
+ */
+static uint8_t a_tea5767_pool_iic_init(void)
+{
+    return 0;        /* success return 0 */
+}
+
+/**
+ * @brief  pool tuner iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   the shared bus is closed by the pool owner
+ */
+static uint8_t a_tea5767_pool_iic_deinit(void)
+{
+    return 0;        /* success return 0 */
+}
+
+/**
+ * @brief     initialize the pool
+ * @param[in] *pool pointer to a tea5767 pool structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 pool is NULL
+ *            - 3 linked functions is NULL
+ * @note      the bus behind the ctx commands is opened by the caller,
+ *            the interface ctx commands serve as the pool commands
+ */
+uint8_t tea5767_pool_init(tea5767_pool_t *pool)
+{
+    if (pool == NULL)                                                       /* check pool */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (pool->debug_print == NULL)                                          /* check debug_print */
+    {
+        return 3;                                                           /* return error */
+    }
+    if (pool->iic_read_ctx_cmd == NULL)                                     /* check iic_read_ctx_cmd */
+    {
+        pool->debug_print("tea5767: iic_read_ctx_cmd is null.\n");          /* iic_read_ctx_cmd is null */
+        
+        return 3;                                                           /* return error */
+    }
+    if (pool->iic_write_ctx_cmd == NULL)                                    /* check iic_write_ctx_cmd */
+    {
+        pool->debug_print("tea5767: iic_write_ctx_cmd is null.\n");         /* iic_write_ctx_cmd is null */
+        
+        return 3;                                                           /* return error */
+    }
+    if (pool->delay_ms == NULL)                                             /* check delay_ms */
+    {
+        pool->debug_print("tea5767: delay_ms is null.\n");                  /* delay_ms is null */
+        
+        return 3;                                                           /* return error */
+    }
+    
+    pool->num = 0;                                                          /* no tuner */
+    pool->inited = 1;                                                       /* flag finish initialization */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     close the pool
+ * @param[in] *pool pointer to a tea5767 pool structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 pool is NULL
+ *            - 3 pool is not initialized
+ * @note      every tuner is powered down
+ */
+uint8_t tea5767_pool_deinit(tea5767_pool_t *pool)
+{
+    uint8_t i;
+    uint8_t res;
+    
+    if (pool == NULL)                                                       /* check pool */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (pool->inited != 1)                                                  /* check pool initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    
+    res = 0;                                                                /* init 0 */
+    for (i = 0; i < pool->num; i++)
+    {
+        if (tea5767_deinit(&pool->handle[i]) != 0)                          /* deinit the tuner */
+        {
+            pool->debug_print("tea5767: tuner %d deinit failed.\n", i);     /* tuner deinit failed */
+            res = 1;                                                        /* set error */
+        }
+    }
+    pool->num = 0;                                                          /* no tuner */
+    pool->inited = 0;                                                       /* flag close */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief      add a tuner to the pool
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  *bus_ctx pointer to the bus context of the tuner, e.g. a mux channel
+ * @param[out] *index pointer to a tuner index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ *             - 4 pool is full
+ * @note       all tuners share the fixed chip address, so each one needs its own bus context
+ */
+uint8_t tea5767_pool_add(tea5767_pool_t *pool, void *bus_ctx, uint8_t *index)
+{
+    tea5767_handle_t *handle;
+    
+    if (pool == NULL)                                                                        /* check pool */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (pool->inited != 1)                                                                   /* check pool initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if (pool->num >= TEA5767_POOL_MAX_DEVICE)                                                /* check the number */
+    {
+        pool->debug_print("tea5767: pool is full.\n");                                       /* pool is full */
+        
+        return 4;                                                                            /* return error */
+    }
+    
+    handle = &pool->handle[pool->num];                                                       /* get the next handle */
+    DRIVER_TEA5767_LINK_INIT(handle, tea5767_handle_t);                                      /* link the handle */
+    DRIVER_TEA5767_LINK_IIC_INIT(handle, a_tea5767_pool_iic_init);                           /* link iic_init */
+    DRIVER_TEA5767_LINK_IIC_DEINIT(handle, a_tea5767_pool_iic_deinit);                       /* link iic_deinit */
+    DRIVER_TEA5767_LINK_IIC_READ_CTX_COMMAND(handle, pool->iic_read_ctx_cmd);                /* link iic_read_ctx_cmd */
+    DRIVER_TEA5767_LINK_IIC_WRITE_CTX_COMMAND(handle, pool->iic_write_ctx_cmd);              /* link iic_write_ctx_cmd */
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_CTX_COMMAND(handle, pool->iic_write_read_ctx_cmd);    /* link iic_write_read_ctx_cmd */
+    DRIVER_TEA5767_LINK_BUS_CTX(handle, bus_ctx);                                            /* link the bus context */
+    DRIVER_TEA5767_LINK_DELAY_MS(handle, pool->delay_ms);                                    /* link delay_ms */
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(handle, pool->debug_print);                              /* link debug_print */
+    if (tea5767_init(handle) != 0)                                                           /* init the tuner */
+    {
+        pool->debug_print("tea5767: tuner %d init failed.\n", pool->num);                    /* tuner init failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    *index = pool->num;                                                                   /* save the index */
+    pool->num++;                                                                             /* add the number */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the handle of a tuner
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  index tuner index
+ * @param[out] **handle pointer to a tea5767 handle pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ *             - 4 index is invalid
+ * @note       the handle can be used with every tea5767 function
+ */
+uint8_t tea5767_pool_get_handle(tea5767_pool_t *pool, uint8_t index, tea5767_handle_t **handle)
+{
+    if (pool == NULL)                                          /* check pool */
+    {
+        return 2;                                              /* return error */
+    }
+    if (pool->inited != 1)                                     /* check pool initialization */
+    {
+        return 3;                                              /* return error */
+    }
+    if (index >= pool->num)                                    /* check the index */
+    {
+        pool->debug_print("tea5767: index is invalid.\n");     /* index is invalid */
+        
+        return 4;                                              /* return error */
+    }
+    
+    *handle = &pool->handle[index];                            /* get the handle */
+    
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief     start a non-blocking scan on every tuner
+ * @param[in] *pool pointer to a tea5767 pool structure
+ * @param[in] mode scan mode
+ * @param[in] *station pointer to a station table of len entries per tuner
+ * @param[in] len station table length of one tuner
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 scan start failed
+ *            - 2 pool is NULL
+ *            - 3 pool is not initialized
+ *            - 4 a tuner is busy
+ * @note      tuner n fills station[n * len] to station[n * len + len - 1],
+ *            when one tuner fails the scans already started are stopped
+ */
+uint8_t tea5767_pool_scan_start(tea5767_pool_t *pool, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint32_t ms)
+{
+    uint8_t i;
+    uint8_t res;
+    
+    if (pool == NULL)                                                                             /* check pool */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (pool->inited != 1)                                                                        /* check pool initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    
+    for (i = 0; i < pool->num; i++)
+    {
+        res = tea5767_scan_start(&pool->handle[i], mode, &station[(uint32_t)i * len], len, ms);   /* start the scan */
+        if (res != 0)                                                                             /* check the result */
+        {
+            pool->debug_print("tea5767: tuner %d scan start failed.\n", i);                       /* scan start failed */
+            while (i > 0)                                                                         /* stop the started scans */
+            {
+                i--;                                                                              /* previous tuner */
+                (void)tea5767_scan_stop(&pool->handle[i]);                                        /* leave the search mode */
+            }
+            
+            return (res == 4) ? 4 : 1;                                                            /* return error */
+        }
+    }
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      run one scheduler pass over the pool
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *busy pointer to a busy tuner number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ * @note       every running scan or search is polled once per pass in index order on its own bus context,
+ *             the chips search on their own between the polls, so the tuners scan in parallel
+ */
+uint8_t tea5767_pool_poll(tea5767_pool_t *pool, uint32_t ms, uint8_t *busy)
+{
+    uint8_t i;
+    uint8_t res;
+    uint16_t num;
+    tea5767_handle_t *handle;
+    tea5767_scan_status_t scan;
+    tea5767_search_status_t search;
+    
+    if (pool == NULL)                                                                   /* check pool */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (pool->inited != 1)                                                              /* check pool initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    
+    res = 0;                                                                            /* init 0 */
+    *busy = 0;                                                                          /* init 0 */
+    for (i = 0; i < pool->num; i++)
+    {
+        handle = &pool->handle[i];                                                      /* get the handle */
+        if (handle->scan.status == TEA5767_SCAN_STATUS_BUSY)                            /* check the scan */
+        {
+            (void)tea5767_scan_poll(handle, ms, &scan, &num);                           /* poll the scan */
+            if (scan == TEA5767_SCAN_STATUS_BUSY)                                       /* check the status */
+            {
+                (*busy)++;                                                              /* add the busy number */
+            }
+        }
+        else if (handle->search_status == TEA5767_SEARCH_STATUS_BUSY)                   /* check the search */
+        {
+            if (tea5767_search_poll(handle, ms, &search) != 0)                          /* poll the search */
+            {
+                res = 1;                                                                /* set error */
+            }
+            else if (search == TEA5767_SEARCH_STATUS_BUSY)                              /* check the status */
+            {
+                (*busy)++;                                                              /* add the busy number */
+            }
+        }
+    }
+    if (res != 0)                                                                       /* check the result */
+    {
+        pool->debug_print("tea5767: poll failed.\n");                                   /* poll failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      scan the whole band on every tuner in parallel
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  mode scan mode
+ * @param[out] *station pointer to a station table of len entries per tuner
+ * @param[in]  len station table length of one tuner
+ * @param[out] *num pointer to a found station number array of one entry per tuner
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ * @note       this function runs tea5767_pool_scan_start and tea5767_pool_poll with a 1ms tick
+ */
+uint8_t tea5767_pool_scan(tea5767_pool_t *pool, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint16_t *num)
+{
+    uint8_t i;
+    uint8_t res;
+    uint8_t busy;
+    uint32_t ms;
+    
+    if (pool == NULL)                                                                /* check pool */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (pool->inited != 1)                                                           /* check pool initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    ms = 0;                                                                          /* init 0 */
+    if (tea5767_pool_scan_start(pool, mode, station, len, ms) != 0)                  /* start the scan */
+    {
+        return 1;                                                                    /* return error */
+    }
+    do
+    {
+        pool->delay_ms(1);                                                           /* delay 1ms */
+        ms++;                                                                        /* add the time */
+        if (tea5767_pool_poll(pool, ms, &busy) != 0)                                 /* run the scheduler */
+        {
+            return 1;                                                                /* return error */
+        }
+    } while (busy != 0);
+    
+    res = 0;                                                                         /* init 0 */
+    for (i = 0; i < pool->num; i++)
+    {
+        num[i] = pool->handle[i].scan.num;                                           /* get the number */
+        if (pool->handle[i].scan.status != TEA5767_SCAN_STATUS_DONE)                 /* check the status */
+        {
+            pool->debug_print("tea5767: tuner %d scan failed.\n", i);                /* tuner scan failed */
+            res = 1;                                                                 /* set error */
+        }
+    }
+    
+    return res;                                                                      /* return the result */
+}
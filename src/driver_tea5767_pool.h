@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_pool.h
+ * @brief     driver tea5767 pool header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_POOL_H
+#define DRIVER_TEA5767_POOL_H
+
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup tea5767_pool_driver tea5767 pool driver function
+ * @brief    tea5767 pool driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+/**
+ * @brief tea5767 pool build option definition
+ */
+#ifndef TEA5767_POOL_MAX_DEVICE
+#define TEA5767_POOL_MAX_DEVICE        8        /**< max tuner number of one pool */
+#endif
+
+/**
+ * @brief tea5767 pool structure definition
+ */
+typedef struct tea5767_pool_s
+{
+    uint8_t (*iic_read_ctx_cmd)(void *ctx, uint8_t addr,
+                                uint8_t *buf, uint16_t len);                   /**< point to an iic_read_ctx_cmd function address */
+    uint8_t (*iic_write_ctx_cmd)(void *ctx, uint8_t addr,
+                                 uint8_t *buf, uint16_t len);                  /**< point to an iic_write_ctx_cmd function address */
+    uint8_t (*iic_write_read_ctx_cmd)(void *ctx, uint8_t addr,
+                                      uint8_t *wbuf, uint16_t wlen,
+                                      uint8_t *rbuf, uint16_t rlen);           /**< point to an iic_write_read_ctx_cmd function address */
+    void (*delay_ms)(uint32_t ms);                                             /**< point to a delay_ms function address */
+    void (*debug_print)(const char *const fmt, ...);                           /**< point to a debug_print function address */
+    tea5767_handle_t handle[TEA5767_POOL_MAX_DEVICE];                          /**< tuner handles */
+    uint8_t num;                                                               /**< tuner number */
+    uint8_t inited;                                                            /**< inited flag */
+} tea5767_pool_t;
+
+/**
+ * @defgroup tea5767_pool_link_driver tea5767 pool link driver function
+ * @brief    tea5767 pool link driver modules
+ * @ingroup  tea5767_pool_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize tea5767_pool_t structure
+ * @param[in] POOL pointer to a tea5767 pool structure
+ * @param[in] STRUCTURE tea5767_pool_t
+ * @note      none
+ */
+#define DRIVER_TEA5767_POOL_LINK_INIT(POOL, STRUCTURE)                  memset(POOL, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link iic_read_ctx_cmd function
+ * @param[in] POOL pointer to a tea5767 pool structure
+ * @param[in] FUC pointer to an iic_read_ctx_cmd function address
+ * @note      none
+ */
+#define DRIVER_TEA5767_POOL_LINK_IIC_READ_CTX_COMMAND(POOL, FUC)        (POOL)->iic_read_ctx_cmd = FUC
+
+/**
+ * @brief     link iic_write_ctx_cmd function
+ * @param[in] POOL pointer to a tea5767 pool structure
+ * @param[in] FUC pointer to an iic_write_ctx_cmd function address
+ * @note      none
+ */
+#define DRIVER_TEA5767_POOL_LINK_IIC_WRITE_CTX_COMMAND(POOL, FUC)       (POOL)->iic_write_ctx_cmd = FUC
+
+/**
+ * @brief     link iic_write_read_ctx_cmd function
+ * @param[in] POOL pointer to a tea5767 pool structure
+ * @param[in] FUC pointer to an iic_write_read_ctx_cmd function address
+ * @note      the write read command is optional and can be NULL
+ */
+#define DRIVER_TEA5767_POOL_LINK_IIC_WRITE_READ_CTX_COMMAND(POOL, FUC)  (POOL)->iic_write_read_ctx_cmd = FUC
+
+/**
+ * @brief     link delay_ms function
+ * @param[in] POOL pointer to a tea5767 pool structure
+ * @param[in] FUC pointer to a delay_ms function address
+ * @note      none
+ */
+#define DRIVER_TEA5767_POOL_LINK_DELAY_MS(POOL, FUC)                    (POOL)->delay_ms = FUC
+
+/**
+ * @brief     link debug_print function
+ * @param[in] POOL pointer to a tea5767 pool structure
+ * @param[in] FUC pointer to a debug_print function address
+ * @note      none
+ */
+#define DRIVER_TEA5767_POOL_LINK_DEBUG_PRINT(POOL, FUC)                 (POOL)->debug_print = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @brief     initialize the pool
+ * @param[in] *pool pointer to a tea5767 pool structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 pool is NULL
+ *            - 3 linked functions is NULL
+ * @note      the bus behind the ctx commands is opened by the caller,
+ *            the interface ctx commands serve as the pool commands
+ */
+uint8_t tea5767_pool_init(tea5767_pool_t *pool);
+
+/**
+ * @brief     close the pool
+ * @param[in] *pool pointer to a tea5767 pool structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 pool is NULL
+ *            - 3 pool is not initialized
+ * @note      every tuner is powered down
+ */
+uint8_t tea5767_pool_deinit(tea5767_pool_t *pool);
+
+/**
+ * @brief      add a tuner to the pool
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  *bus_ctx pointer to the bus context of the tuner, e.g. a mux channel
+ * @param[out] *index pointer to a tuner index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ *             - 4 pool is full
+ * @note       all tuners share the fixed chip address, so each one needs its own bus context
+ */
+uint8_t tea5767_pool_add(tea5767_pool_t *pool, void *bus_ctx, uint8_t *index);
+
+/**
+ * @brief      get the handle of a tuner
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  index tuner index
+ * @param[out] **handle pointer to a tea5767 handle pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ *             - 4 index is invalid
+ * @note       the handle can be used with every tea5767 function
+ */
+uint8_t tea5767_pool_get_handle(tea5767_pool_t *pool, uint8_t index, tea5767_handle_t **handle);
+
+/**
+ * @brief     start a non-blocking scan on every tuner
+ * @param[in] *pool pointer to a tea5767 pool structure
+ * @param[in] mode scan mode
+ * @param[in] *station pointer to a station table of len entries per tuner
+ * @param[in] len station table length of one tuner
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 scan start failed
+ *            - 2 pool is NULL
+ *            - 3 pool is not initialized
+ *            - 4 a tuner is busy
+ * @note      tuner n fills station[n * len] to station[n * len + len - 1],
+ *            when one tuner fails the scans already started are stopped
+ */
+uint8_t tea5767_pool_scan_start(tea5767_pool_t *pool, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint32_t ms);
+
+/**
+ * @brief      run one scheduler pass over the pool
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *busy pointer to a busy tuner number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ * @note       every running scan or search is polled once per pass in index order on its own bus context,
+ *             the chips search on their own between the polls, so the tuners scan in parallel
+ */
+uint8_t tea5767_pool_poll(tea5767_pool_t *pool, uint32_t ms, uint8_t *busy);
+
+/**
+ * @brief      scan the whole band on every tuner in parallel
+ * @param[in]  *pool pointer to a tea5767 pool structure
+ * @param[in]  mode scan mode
+ * @param[out] *station pointer to a station table of len entries per tuner
+ * @param[in]  len station table length of one tuner
+ * @param[out] *num pointer to a found station number array of one entry per tuner
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 pool is NULL
+ *             - 3 pool is not initialized
+ * @note       this function runs tea5767_pool_scan_start and tea5767_pool_poll with a 1ms tick
+ */
+uint8_t tea5767_pool_scan(tea5767_pool_t *pool, tea5767_scan_mode_t mode, tea5767_station_t *station, uint16_t len, uint16_t *num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
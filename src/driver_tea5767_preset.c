@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_preset.c
+ * @brief     driver tea5767 preset source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_preset.h"
+#include <stddef.h>
+
+/**
+ * @brief     get the crc32 of the store
+ * @param[in] *store pointer to a preset store
+ * @return    crc32
+ * @note      reflected 0xEDB88320 polynomial over all bytes before the crc field
+ */
+static uint32_t a_tea5767_preset_crc(const tea5767_preset_store_t *store)
+{
+    const uint8_t *p;
+    uint32_t crc;
+    uint32_t i;
+    uint8_t j;
+    
+    p = (const uint8_t *)store;                                               /* get the blob */
+    crc = 0xFFFFFFFFUL;                                                       /* init the crc */
+    for (i = 0; i < (uint32_t)offsetof(tea5767_preset_store_t, crc); i++)     /* all bytes before the crc */
+    {
+        crc ^= p[i];                                                          /* add the byte */
+        for (j = 0; j < 8; j++)                                               /* all bits */
+        {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 0x01)));         /* shift without branch */
+        }
+    }
+    
+    return crc ^ 0xFFFFFFFFUL;                                                /* return the crc */
+}
+
+/**
+ * @brief     initialize an empty store
+ * @param[in] *store pointer to a preset store
+ * @return    status code
+ *            - 0 success
+ *            - 2 store is NULL
+ * @note      all records are cleared and the crc is sealed
+ */
+uint8_t tea5767_preset_init(tea5767_preset_store_t *store)
+{
+    if (store == NULL)                                    /* check store */
+    {
+        return 2;                                         /* return error */
+    }
+    
+    memset(store, 0, sizeof(tea5767_preset_store_t));     /* clear the store */
+    store->magic = TEA5767_PRESET_MAGIC;                  /* set the magic */
+    store->version = TEA5767_PRESET_VERSION;              /* set the version */
+    store->capacity = TEA5767_PRESET_MAX;                 /* set the capacity */
+    store->crc = a_tea5767_preset_crc(store);             /* seal the crc */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     check a loaded store
+ * @param[in] *store pointer to a preset store
+ * @param[in] len loaded blob length
+ * @return    status code
+ *            - 0 success
+ *            - 1 crc is invalid
+ *            - 2 store is NULL
+ *            - 4 len is invalid
+ *            - 5 magic, version or capacity is invalid
+ * @note      call it once after the store is read, mapped or found in flash, recall does not check the crc
+ */
+uint8_t tea5767_preset_check(const tea5767_preset_store_t *store, uint32_t len)
+{
+    if (store == NULL)                                 /* check store */
+    {
+        return 2;                                      /* return error */
+    }
+    if (len < sizeof(tea5767_preset_store_t))          /* check the length */
+    {
+        return 4;                                      /* return error */
+    }
+    if ((store->magic != TEA5767_PRESET_MAGIC) || 
+        (store->version != TEA5767_PRESET_VERSION) || 
+        (store->capacity != TEA5767_PRESET_MAX))       /* check the header */
+    {
+        return 5;                                      /* return error */
+    }
+    if (store->crc != a_tea5767_preset_crc(store))     /* check the crc */
+    {
+        return 1;                                      /* return error */
+    }
+    
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief     save the tuned station into a record
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 store is NULL
+ *            - 5 index is invalid
+ * @note      the pll, clock, band, side injection and de-emphasis are taken from the local conf,
+ *            the level is taken from the last read status and the crc is sealed
+ */
+uint8_t tea5767_preset_save(tea5767_handle_t *handle, tea5767_preset_store_t *store, uint8_t index)
+{
+    tea5767_preset_record_t *record;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if (store == NULL)                                                                   /* check store */
+    {
+        handle->debug_print("tea5767: store is null.\n");                                /* store is null */
+        
+        return 4;                                                                        /* return error */
+    }
+    if (index >= TEA5767_PRESET_MAX)                                                     /* check the index */
+    {
+        handle->debug_print("tea5767: index is invalid.\n");                             /* index is invalid */
+        
+        return 5;                                                                        /* return error */
+    }
+    
+    record = &store->record[index];                                                      /* get the record */
+    record->pll = ((uint16_t)(handle->conf_up[0] & 0x3F) << 8) | handle->conf_up[1];     /* save the pll */
+    record->flags = TEA5767_PRESET_FLAG_USED |
+                    ((handle->conf_up[3] >> 4) & 0x01) |
+                    (((handle->conf_up[4] >> 7) & 0x01) << 1) |
+                    (handle->conf_up[2] & TEA5767_PRESET_FLAG_HLSI) |
+                    (handle->conf_up[3] & TEA5767_PRESET_FLAG_JAPANESE) |
+                    (handle->conf_up[4] & TEA5767_PRESET_FLAG_75US);                     /* save the flags */
+    record->level = (handle->conf_down[3] >> 4) & 0x0F;                                  /* save the last level */
+    store->crc = a_tea5767_preset_crc(store);                                            /* seal the crc */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     erase a record
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 2 store is NULL
+ *            - 5 index is invalid
+ * @note      the crc is sealed
+ */
+uint8_t tea5767_preset_erase(tea5767_preset_store_t *store, uint8_t index)
+{
+    if (store == NULL)                                                     /* check store */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (index >= TEA5767_PRESET_MAX)                                       /* check the index */
+    {
+        return 5;                                                          /* return error */
+    }
+    
+    memset(&store->record[index], 0, sizeof(tea5767_preset_record_t));     /* clear the record */
+    store->crc = a_tea5767_preset_crc(store);                              /* seal the crc */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     recall a record
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 store is NULL
+ *            - 5 index is invalid
+ *            - 6 record is empty
+ * @note      the record is masked into the local conf without any conversion and sent as one 5 bytes write,
+ *            the clock of the pll word is restored, the search mode is cleared and the other settings are kept
+ */
+uint8_t tea5767_preset_recall(tea5767_handle_t *handle, const tea5767_preset_store_t *store, uint8_t index)
+{
+    tea5767_preset_record_t record;
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (store == NULL)                                                                 /* check store */
+    {
+        handle->debug_print("tea5767: store is null.\n");                              /* store is null */
+        
+        return 4;                                                                      /* return error */
+    }
+    if (index >= TEA5767_PRESET_MAX)                                                   /* check the index */
+    {
+        handle->debug_print("tea5767: index is invalid.\n");                           /* index is invalid */
+        
+        return 5;                                                                      /* return error */
+    }
+    
+    record = store->record[index];                                                     /* copy the record */
+    if ((record.flags & TEA5767_PRESET_FLAG_USED) == 0)                                /* check the record */
+    {
+        handle->debug_print("tea5767: record is empty.\n");                            /* record is empty */
+        
+        return 6;                                                                      /* return error */
+    }
+    handle->conf_up[0] = (handle->conf_up[0] & 0x80) | ((record.pll >> 8) & 0x3F);     /* keep the mute, clear the search mode */
+    handle->conf_up[1] = record.pll & 0xFF;                                            /* set the pll low */
+    handle->conf_up[2] = (handle->conf_up[2] & ~TEA5767_PRESET_FLAG_HLSI) |
+                         (record.flags & TEA5767_PRESET_FLAG_HLSI);                    /* set the side injection */
+    handle->conf_up[3] = (handle->conf_up[3] & ~(TEA5767_PRESET_FLAG_JAPANESE | (1 << 4))) |
+                         (record.flags & TEA5767_PRESET_FLAG_JAPANESE) |
+                         ((record.flags & 0x01) << 4);                                 /* set the band and the xtal */
+    handle->conf_up[4] = (handle->conf_up[4] & ~(TEA5767_PRESET_FLAG_75US | (1 << 7))) |
+                         (record.flags & TEA5767_PRESET_FLAG_75US) |
+                         (((record.flags >> 1) & 0x01) << 7);                          /* set the de-emphasis and the pllref */
+    
+    return tea5767_write_conf(handle);                                                 /* write the whole conf */
+}
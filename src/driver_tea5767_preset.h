@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_preset.h
+ * @brief     driver tea5767 preset header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_PRESET_H
+#define DRIVER_TEA5767_PRESET_H
+
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup tea5767_preset_driver tea5767 preset driver function
+ * @brief    tea5767 preset driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+/**
+ * @brief tea5767 preset build option definition
+ */
+#ifndef TEA5767_PRESET_MAX
+#define TEA5767_PRESET_MAX              16                /**< preset records of one store */
+#endif
+
+/**
+ * @brief tea5767 preset blob definition
+ */
+#define TEA5767_PRESET_MAGIC            0x37363735UL      /**< "5767" in little endian */
+#define TEA5767_PRESET_VERSION          0x0002            /**< blob layout version */
+
+/**
+ * @brief tea5767 preset flag definition
+ * @note  every flag sits on the bit of its conf byte, so a recall only masks the bytes,
+ *        the clock bits collide with the other flags and are kept as a tea5767_clock_t in bits 0 - 1
+ */
+#define TEA5767_PRESET_FLAG_CLOCK       (3 << 0)          /**< xtal and pllref, conf byte 3 bit 4 and conf byte 4 bit 7 */
+#define TEA5767_PRESET_FLAG_HLSI        (1 << 4)          /**< high side injection, conf byte 2 */
+#define TEA5767_PRESET_FLAG_JAPANESE    (1 << 5)          /**< Japanese band, conf byte 3 */
+#define TEA5767_PRESET_FLAG_75US        (1 << 6)          /**< 75us de-emphasis, conf byte 4 */
+#define TEA5767_PRESET_FLAG_USED        (1 << 7)          /**< record is used */
+
+/**
+ * @brief tea5767 preset record structure definition
+ */
+typedef struct tea5767_preset_record_s
+{
+    uint16_t pll;          /**< pll word */
+    uint8_t flags;         /**< preset flags */
+    uint8_t level;         /**< last level adc output */
+} tea5767_preset_record_t;
+
+/**
+ * @brief tea5767 preset store structure definition
+ * @note  the store is its own blob, every field is naturally aligned and there is no padding,
+ *        so it can be mapped from a file or placed in flash and checked in place,
+ *        the blob is kept in the host byte order and a swapped magic is rejected
+ */
+typedef struct tea5767_preset_store_s
+{
+    uint32_t magic;                                              /**< TEA5767_PRESET_MAGIC */
+    uint16_t version;                                            /**< TEA5767_PRESET_VERSION */
+    uint16_t capacity;                                           /**< record number */
+    tea5767_preset_record_t record[TEA5767_PRESET_MAX];          /**< records */
+    uint32_t crc;                                                /**< crc32 of all bytes before */
+} tea5767_preset_store_t;
+
+/**
+ * @brief     initialize an empty store
+ * @param[in] *store pointer to a preset store
+ * @return    status code
+ *            - 0 success
+ *            - 2 store is NULL
+ * @note      all records are cleared and the crc is sealed
+ */
+uint8_t tea5767_preset_init(tea5767_preset_store_t *store);
+
+/**
+ * @brief     check a loaded store
+ * @param[in] *store pointer to a preset store
+ * @param[in] len loaded blob length
+ * @return    status code
+ *            - 0 success
+ *            - 1 crc is invalid
+ *            - 2 store is NULL
+ *            - 4 len is invalid
+ *            - 5 magic, version or capacity is invalid
+ * @note      call it once after the store is read, mapped or found in flash, recall does not check the crc
+ */
+uint8_t tea5767_preset_check(const tea5767_preset_store_t *store, uint32_t len);
+
+/**
+ * @brief     save the tuned station into a record
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 store is NULL
+ *            - 5 index is invalid
+ * @note      the pll, clock, band, side injection and de-emphasis are taken from the local conf,
+ *            the level is taken from the last read status and the crc is sealed
+ */
+uint8_t tea5767_preset_save(tea5767_handle_t *handle, tea5767_preset_store_t *store, uint8_t index);
+
+/**
+ * @brief     erase a record
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 2 store is NULL
+ *            - 5 index is invalid
+ * @note      the crc is sealed
+ */
+uint8_t tea5767_preset_erase(tea5767_preset_store_t *store, uint8_t index);
+
+/**
+ * @brief     recall a record
+ * @param[in] *handle pointer to a tea5767 handle structure
+ * @param[in] *store pointer to a preset store
+ * @param[in] index record index
+ * @return    status code
+ *            - 0 success
+ *            - 1 write conf failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 store is NULL
+ *            - 5 index is invalid
+ *            - 6 record is empty
+ * @note      the record is masked into the local conf without any conversion and sent as one 5 bytes write,
+ *            the clock of the pll word is restored, the search mode is cleared and the other settings are kept
+ */
+uint8_t tea5767_preset_recall(tea5767_handle_t *handle, const tea5767_preset_store_t *store, uint8_t index);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
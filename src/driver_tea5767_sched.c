@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_sched.c
+ * @brief     driver tea5767 sched source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_sched.h"
+
+/**
+ * @brief     initialize the scheduler
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ * @note      none
+ */
+uint8_t tea5767_sched_init(tea5767_sched_t *sched)
+{
+    if (sched == NULL)                                 /* check sched */
+    {
+        return 2;                                      /* return error */
+    }
+    
+    memset(sched, 0, sizeof(tea5767_sched_t));         /* clear the scheduler */
+    sched->inited = 1;                                 /* flag finish initialization */
+    
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief     add a prepared task to the scheduler
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @param[in] *task pointer to a prepared tea5767 task structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched or task is NULL
+ *            - 3 sched is not initialized
+ *            - 4 sched is full
+ * @note      the task must stay valid until it finishes or is removed,
+ *            two tasks of the same tuner must not run at the same time
+ */
+uint8_t tea5767_sched_add(tea5767_sched_t *sched, tea5767_task_t *task)
+{
+    if ((sched == NULL) || (task == NULL))              /* check sched and task */
+    {
+        return 2;                                       /* return error */
+    }
+    if (sched->inited != 1)                             /* check sched initialization */
+    {
+        return 3;                                       /* return error */
+    }
+    if (sched->num >= TEA5767_SCHED_MAX_TASK)           /* check the task number */
+    {
+        return 4;                                       /* return error */
+    }
+    
+    sched->task[sched->num] = task;                     /* save the task */
+    sched->num++;                                       /* add the number */
+    
+    return 0;                                           /* success return 0 */
+}
+
+/**
+ * @brief     remove a task from the scheduler
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched or task is NULL
+ *            - 3 sched is not initialized
+ *            - 4 task is not found
+ * @note      the task is dropped where it stands and keeps its busy status
+ */
+uint8_t tea5767_sched_remove(tea5767_sched_t *sched, tea5767_task_t *task)
+{
+    uint8_t i;
+    
+    if ((sched == NULL) || (task == NULL))                      /* check sched and task */
+    {
+        return 2;                                               /* return error */
+    }
+    if (sched->inited != 1)                                     /* check sched initialization */
+    {
+        return 3;                                               /* return error */
+    }
+    
+    for (i = 0; i < sched->num; i++)
+    {
+        if (sched->task[i] == task)                             /* find the task */
+        {
+            sched->num--;                                       /* sub the number */
+            sched->task[i] = sched->task[sched->num];           /* move the last task */
+            
+            return 0;                                           /* success return 0 */
+        }
+    }
+    
+    return 4;                                                   /* return error */
+}
+
+/**
+ * @brief      run one scheduler pass
+ * @param[in]  *sched pointer to a tea5767 sched structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *busy pointer to a running task number buffer
+ * @param[out] *wake_ms pointer to a next wake timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched is NULL
+ *             - 3 sched is not initialized
+ * @note       every due task runs one step in round robin order starting one task later each pass,
+ *             finished tasks leave the scheduler and keep their result,
+ *             wake_ms is the earliest wake time of the running tasks and is valid when busy is not 0
+ */
+uint8_t tea5767_sched_poll(tea5767_sched_t *sched, uint32_t ms, uint8_t *busy, uint32_t *wake_ms)
+{
+    uint8_t i;
+    uint8_t num;
+    tea5767_task_t *task;
+    tea5767_task_status_t status;
+    
+    if (sched == NULL)                                                              /* check sched */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (sched->inited != 1)                                                         /* check sched initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    
+    num = sched->num;                                                               /* save the number */
+    for (i = 0; i < num; i++)
+    {
+        task = sched->task[(sched->next + i) % num];                                /* round robin */
+        if (tea5767_task_step(task, ms, &status) != 0)                              /* run the task */
+        {
+            status = TEA5767_TASK_STATUS_ERROR;                                     /* task is not prepared */
+        }
+        if (status != TEA5767_TASK_STATUS_BUSY)                                     /* check the status */
+        {
+            task->status = (uint8_t)status;                                         /* keep the result */
+        }
+    }
+    
+    *busy = 0;                                                                      /* init 0 */
+    *wake_ms = ms;                                                                  /* init the timestamp */
+    i = 0;                                                                          /* init 0 */
+    while (i < sched->num)
+    {
+        task = sched->task[i];                                                      /* get the task */
+        if (task->status != TEA5767_TASK_STATUS_BUSY)                               /* check the status */
+        {
+            sched->num--;                                                           /* sub the number */
+            sched->task[i] = sched->task[sched->num];                               /* move the last task */
+            
+            continue;                                                               /* check the moved task */
+        }
+        if (((*busy) == 0) || ((int32_t)(task->wake_ms - (*wake_ms)) < 0))          /* check the wake time */
+        {
+            *wake_ms = task->wake_ms;                                               /* save the earliest wake time */
+        }
+        (*busy)++;                                                                  /* add the busy number */
+        i++;                                                                        /* next task */
+    }
+    if (sched->num != 0)                                                            /* check the number */
+    {
+        sched->next = (uint8_t)((sched->next + 1) % sched->num);                    /* move the cursor */
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     run the scheduler until every task finishes
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @param[in] *delay_ms pointer to a delay_ms function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched or delay_ms is NULL
+ *            - 3 sched is not initialized
+ * @note      the timestamps start from 0 and the scheduler sleeps until the earliest wake time,
+ *            the task results are read from the tasks
+ */
+uint8_t tea5767_sched_run(tea5767_sched_t *sched, void (*delay_ms)(uint32_t ms))
+{
+    uint8_t busy;
+    uint32_t ms;
+    uint32_t wake_ms;
+    
+    if ((sched == NULL) || (delay_ms == NULL))                          /* check sched and delay_ms */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (sched->inited != 1)                                             /* check sched initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    
+    ms = 0;                                                             /* init 0 */
+    while (1)
+    {
+        (void)tea5767_sched_poll(sched, ms, &busy, &wake_ms);           /* run one pass */
+        if (busy == 0)                                                  /* check the busy number */
+        {
+            break;                                                      /* break */
+        }
+        if ((int32_t)(wake_ms - ms) > 0)                                /* check the wake time */
+        {
+            delay_ms(wake_ms - ms);                                     /* sleep until the earliest task */
+            ms = wake_ms;                                               /* add the time */
+        }
+    }
+    
+    return 0;                                                           /* success return 0 */
+}
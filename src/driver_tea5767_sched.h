@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_sched.h
+ * @brief     driver tea5767 sched header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_SCHED_H
+#define DRIVER_TEA5767_SCHED_H
+
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup tea5767_sched_driver tea5767 sched driver function
+ * @brief    tea5767 sched driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+/**
+ * @brief tea5767 sched build option definition
+ */
+#ifndef TEA5767_SCHED_MAX_TASK
+#define TEA5767_SCHED_MAX_TASK        16        /**< max task number of one scheduler */
+#endif
+
+/**
+ * @brief tea5767 sched structure definition
+ * @note  the tasks can belong to different tuners or to other peripherals with their own step functions
+ */
+typedef struct tea5767_sched_s
+{
+    tea5767_task_t *task[TEA5767_SCHED_MAX_TASK];        /**< running tasks */
+    uint8_t num;                                         /**< running task number */
+    uint8_t next;                                        /**< round robin cursor */
+    uint8_t inited;                                      /**< inited flag */
+} tea5767_sched_t;
+
+/**
+ * @brief     initialize the scheduler
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ * @note      none
+ */
+uint8_t tea5767_sched_init(tea5767_sched_t *sched);
+
+/**
+ * @brief     add a prepared task to the scheduler
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @param[in] *task pointer to a prepared tea5767 task structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched or task is NULL
+ *            - 3 sched is not initialized
+ *            - 4 sched is full
+ * @note      the task must stay valid until it finishes or is removed,
+ *            two tasks of the same tuner must not run at the same time
+ */
+uint8_t tea5767_sched_add(tea5767_sched_t *sched, tea5767_task_t *task);
+
+/**
+ * @brief     remove a task from the scheduler
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @param[in] *task pointer to a tea5767 task structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched or task is NULL
+ *            - 3 sched is not initialized
+ *            - 4 task is not found
+ * @note      the task is dropped where it stands and keeps its busy status
+ */
+uint8_t tea5767_sched_remove(tea5767_sched_t *sched, tea5767_task_t *task);
+
+/**
+ * @brief      run one scheduler pass
+ * @param[in]  *sched pointer to a tea5767 sched structure
+ * @param[in]  ms current timestamp in ms
+ * @param[out] *busy pointer to a running task number buffer
+ * @param[out] *wake_ms pointer to a next wake timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched is NULL
+ *             - 3 sched is not initialized
+ * @note       every due task runs one step in round robin order starting one task later each pass,
+ *             finished tasks leave the scheduler and keep their result,
+ *             wake_ms is the earliest wake time of the running tasks and is valid when busy is not 0
+ */
+uint8_t tea5767_sched_poll(tea5767_sched_t *sched, uint32_t ms, uint8_t *busy, uint32_t *wake_ms);
+
+/**
+ * @brief     run the scheduler until every task finishes
+ * @param[in] *sched pointer to a tea5767 sched structure
+ * @param[in] *delay_ms pointer to a delay_ms function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched or delay_ms is NULL
+ *            - 3 sched is not initialized
+ * @note      the timestamps start from 0 and the scheduler sleeps until the earliest wake time,
+ *            the task results are read from the tasks
+ */
+uint8_t tea5767_sched_run(tea5767_sched_t *sched, void (*delay_ms)(uint32_t ms));
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
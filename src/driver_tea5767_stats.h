@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_stats.h
+ * @brief     driver tea5767 stats header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_STATS_H
+#define DRIVER_TEA5767_STATS_H
+
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup tea5767_stats_driver tea5767 stats driver function
+ * @brief    tea5767 stats driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the stats
+ * @param[in] *stats pointer to a tea5767 stats structure
+ * @param[in] *clock_us pointer to a clock_us function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 4 clock_us is NULL
+ * @note      link the stats to a handle with DRIVER_TEA5767_LINK_STATS to start counting
+ */
+uint8_t tea5767_stats_init(tea5767_stats_t *stats, uint32_t (*clock_us)(void));
+
+/**
+ * @brief     reset all counters
+ * @param[in] *stats pointer to a tea5767 stats structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ * @note      the clock is kept
+ */
+uint8_t tea5767_stats_reset(tea5767_stats_t *stats);
+
+/**
+ * @brief      take a snapshot of all counters
+ * @param[in]  *stats pointer to a tea5767 stats structure
+ * @param[out] *snapshot pointer to a snapshot buffer
+ * @param[in]  reset 1 resets the counters after the snapshot
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or snapshot is NULL
+ * @note       call it from the context that runs the driver, the counters are not locked,
+ *             an async transfer counts in its completion context, so take the snapshot after it is handed back
+ */
+uint8_t tea5767_stats_snapshot(tea5767_stats_t *stats, tea5767_stats_t *snapshot, uint8_t reset);
+
+/**
+ * @brief      get a latency percentile of a counter
+ * @param[in]  *counter pointer to a stats counter
+ * @param[in]  permille percentile in permille, e.g. 500 or 990
+ * @param[out] *us pointer to a latency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 counter is empty
+ *             - 2 counter or us is NULL
+ *             - 4 permille > 1000
+ * @note       the result is the upper edge of the log2 bucket, limited by the max latency
+ */
+uint8_t tea5767_stats_percentile(const tea5767_stats_counter_t *counter, uint16_t permille, uint32_t *us);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
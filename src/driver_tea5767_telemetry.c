@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_telemetry.c
+ * @brief     driver tea5767 telemetry source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_telemetry.h"
+
+/**
+ * @brief     initialize the telemetry
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] *handle pointer to an initialized tea5767 handle structure
+ * @param[in] *ring pointer to a sample ring
+ * @return    status code
+ *            - 0 success
+ *            - 2 telemetry is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ring is NULL
+ * @note      the ring is cleared and sampling is stopped
+ */
+uint8_t tea5767_telemetry_init(tea5767_telemetry_t *telemetry, tea5767_handle_t *handle, tea5767_telemetry_ring_t *ring)
+{
+    if (telemetry == NULL)                                   /* check telemetry */
+    {
+        return 2;                                            /* return error */
+    }
+    if ((handle == NULL) || (handle->inited != 1))           /* check handle initialization */
+    {
+        return 3;                                            /* return error */
+    }
+    if (ring == NULL)                                        /* check ring */
+    {
+        handle->debug_print("tea5767: ring is null.\n");     /* ring is null */
+        
+        return 4;                                            /* return error */
+    }
+    
+    memset(ring, 0, sizeof(tea5767_telemetry_ring_t));       /* clear the ring */
+    telemetry->handle = handle;                              /* save the handle */
+    telemetry->ring = ring;                                  /* save the ring */
+    telemetry->next_ms = 0;                                  /* no sample due */
+    telemetry->inited = 1;                                   /* flag finish initialization */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the sample period
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] period_ms sample period in ms, 0 stops sampling
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 telemetry is NULL
+ *            - 3 telemetry is not initialized
+ * @note      the first sample is due at once
+ */
+uint8_t tea5767_telemetry_set_period(tea5767_telemetry_t *telemetry, uint32_t period_ms, uint32_t ms)
+{
+    if (telemetry == NULL)                      /* check telemetry */
+    {
+        return 2;                               /* return error */
+    }
+    if (telemetry->inited != 1)                 /* check telemetry initialization */
+    {
+        return 3;                               /* return error */
+    }
+    
+    telemetry->next_ms = ms;                    /* sample at once */
+    telemetry->ring->period_ms = period_ms;     /* publish the period */
+    
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief     take one sample now
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 telemetry is NULL
+ *            - 3 telemetry is not initialized
+ * @note      frequency, level, if, reception and ready flag are decoded from one 4 bytes read
+ */
+uint8_t tea5767_telemetry_sample(tea5767_telemetry_t *telemetry, uint32_t ms)
+{
+    uint32_t head;
+    tea5767_status_t status;
+    tea5767_telemetry_sample_t *sample;
+    
+    if (telemetry == NULL)                                                              /* check telemetry */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (telemetry->inited != 1)                                                         /* check telemetry initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    
+    if (tea5767_read_status_snapshot(telemetry->handle, &status) != 0)                  /* read up to the level */
+    {
+        telemetry->handle->debug_print("tea5767: read status snapshot failed.\n");      /* read status snapshot failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    
+    head = telemetry->ring->head;                                                       /* only this function writes the head */
+    sample = &telemetry->ring->sample[head & (TEA5767_TELEMETRY_RING_SIZE - 1)];        /* get the slot */
+    sample->timestamp_ms = ms;                                                          /* set the timestamp */
+    sample->khz = status.khz;                                                           /* set the frequency */
+    sample->level = status.level;                                                       /* set the level */
+    sample->if_out = status.if_out;                                                     /* set the if */
+    sample->reception = (uint8_t)status.reception;                                      /* set the reception */
+    sample->ready = (uint8_t)status.ready;                                              /* set the ready flag */
+    TEA5767_TELEMETRY_BARRIER();                                                        /* write the slot before the head */
+    telemetry->ring->head = head + 1;                                                   /* publish the sample */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     take a sample when it is due
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 telemetry is NULL
+ *            - 3 telemetry is not initialized
+ * @note      call it at least once per period, samples missed by a late call are skipped instead of bursting
+ */
+uint8_t tea5767_telemetry_poll(tea5767_telemetry_t *telemetry, uint32_t ms)
+{
+    uint32_t period;
+    
+    if (telemetry == NULL)                                             /* check telemetry */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (telemetry->inited != 1)                                        /* check telemetry initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    period = telemetry->ring->period_ms;                               /* get the period */
+    if ((period == 0) || ((int32_t)(ms - telemetry->next_ms) < 0))     /* check the sample time */
+    {
+        return 0;                                                      /* not due */
+    }
+    telemetry->next_ms += period;                                      /* keep the sample grid */
+    if ((int32_t)(ms - telemetry->next_ms) >= 0)                       /* check a late call */
+    {
+        telemetry->next_ms = ms + period;                              /* skip the missed samples */
+    }
+    
+    return tea5767_telemetry_sample(telemetry, ms);                    /* take the sample */
+}
+
+/**
+ * @brief      subscribe to a ring
+ * @param[in]  *ring pointer to a sample ring
+ * @param[out] *reader pointer to a reader structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring or reader is NULL
+ * @note       the reader starts with the next sample, any number of readers can subscribe
+ */
+uint8_t tea5767_telemetry_subscribe(tea5767_telemetry_ring_t *ring, tea5767_telemetry_reader_t *reader)
+{
+    if ((ring == NULL) || (reader == NULL))     /* check ring and reader */
+    {
+        return 2;                               /* return error */
+    }
+    
+    reader->tail = ring->head;                  /* start with the next sample */
+    reader->lost = 0;                           /* nothing lost */
+    
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief         read the next sample
+ * @param[in]     *ring pointer to a sample ring
+ * @param[in,out] *reader pointer to a reader structure
+ * @param[out]    *sample pointer to a sample buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no new sample
+ *                - 2 ring, reader or sample is NULL
+ * @note          lock free, a slow reader skips the overwritten samples and counts them as lost
+ */
+uint8_t tea5767_telemetry_read(tea5767_telemetry_ring_t *ring, tea5767_telemetry_reader_t *reader, tea5767_telemetry_sample_t *sample)
+{
+    uint32_t head;
+    
+    if ((ring == NULL) || (reader == NULL) || (sample == NULL))                          /* check ring, reader and sample */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    while (1)
+    {
+        head = ring->head;                                                               /* get the head */
+        TEA5767_TELEMETRY_BARRIER();                                                     /* read the head before the slot */
+        if (head == reader->tail)                                                        /* check new samples */
+        {
+            return 1;                                                                    /* no new sample */
+        }
+        if ((head - reader->tail) >= TEA5767_TELEMETRY_RING_SIZE)                        /* check the overwritten samples */
+        {
+            reader->lost += head - reader->tail - (TEA5767_TELEMETRY_RING_SIZE - 1);     /* count the lost samples */
+            reader->tail = head - (TEA5767_TELEMETRY_RING_SIZE - 1);                     /* skip to the oldest stable sample */
+        }
+        *sample = ring->sample[reader->tail & (TEA5767_TELEMETRY_RING_SIZE - 1)];        /* copy the sample */
+        TEA5767_TELEMETRY_BARRIER();                                                     /* copy the slot before the check */
+        if ((ring->head - reader->tail) < TEA5767_TELEMETRY_RING_SIZE)                   /* check the slot was not rewritten */
+        {
+            reader->tail++;                                                              /* next sample */
+            
+            return 0;                                                                    /* success return 0 */
+        }
+    }
+}
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_telemetry.h
+ * @brief     driver tea5767 telemetry header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_TELEMETRY_H
+#define DRIVER_TEA5767_TELEMETRY_H
+
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup tea5767_telemetry_driver tea5767 telemetry driver function
+ * @brief    tea5767 telemetry driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+/**
+ * @brief tea5767 telemetry build option definition
+ */
+#ifndef TEA5767_TELEMETRY_RING_SIZE
+#define TEA5767_TELEMETRY_RING_SIZE        64                        /**< samples of one ring, must be a power of 2 */
+#endif
+#ifndef TEA5767_TELEMETRY_BARRIER
+#if defined(__GNUC__)
+#define TEA5767_TELEMETRY_BARRIER()        __sync_synchronize()      /**< full memory barrier */
+#else
+#define TEA5767_TELEMETRY_BARRIER()                                  /**< single core targets need no barrier */
+#endif
+#endif
+
+/**
+ * @brief tea5767 telemetry sample structure definition
+ */
+typedef struct tea5767_telemetry_sample_s
+{
+    uint32_t timestamp_ms;        /**< sample time in ms */
+    uint32_t khz;                 /**< frequency in KHz */
+    uint8_t level;                /**< level adc output */
+    uint8_t if_out;               /**< if counter */
+    uint8_t reception;            /**< tea5767_reception_t */
+    uint8_t ready;                /**< ready flag */
+} tea5767_telemetry_sample_t;
+
+/**
+ * @brief tea5767 telemetry ring structure definition
+ * @note  the ring holds no pointer, so it can be placed in shared memory and read by other processes
+ */
+typedef struct tea5767_telemetry_ring_s
+{
+    volatile uint32_t head;                                                 /**< written sample number */
+    volatile uint32_t period_ms;                                            /**< sample period, 0 means stopped */
+    tea5767_telemetry_sample_t sample[TEA5767_TELEMETRY_RING_SIZE];         /**< sample slots */
+} tea5767_telemetry_ring_t;
+
+/**
+ * @brief tea5767 telemetry reader structure definition
+ */
+typedef struct tea5767_telemetry_reader_s
+{
+    uint32_t tail;        /**< next sample number */
+    uint32_t lost;        /**< overwritten sample number */
+} tea5767_telemetry_reader_t;
+
+/**
+ * @brief tea5767 telemetry structure definition
+ */
+typedef struct tea5767_telemetry_s
+{
+    tea5767_handle_t *handle;              /**< sampled tuner */
+    tea5767_telemetry_ring_t *ring;        /**< sample ring */
+    uint32_t next_ms;                      /**< next sample time */
+    uint8_t inited;                        /**< inited flag */
+} tea5767_telemetry_t;
+
+/**
+ * @brief     initialize the telemetry
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] *handle pointer to an initialized tea5767 handle structure
+ * @param[in] *ring pointer to a sample ring
+ * @return    status code
+ *            - 0 success
+ *            - 2 telemetry is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ring is NULL
+ * @note      the ring is cleared and sampling is stopped
+ */
+uint8_t tea5767_telemetry_init(tea5767_telemetry_t *telemetry, tea5767_handle_t *handle, tea5767_telemetry_ring_t *ring);
+
+/**
+ * @brief     set the sample period
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] period_ms sample period in ms, 0 stops sampling
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 telemetry is NULL
+ *            - 3 telemetry is not initialized
+ * @note      the first sample is due at once
+ */
+uint8_t tea5767_telemetry_set_period(tea5767_telemetry_t *telemetry, uint32_t period_ms, uint32_t ms);
+
+/**
+ * @brief     take one sample now
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 telemetry is NULL
+ *            - 3 telemetry is not initialized
+ * @note      level, if, reception and ready flag are decoded from one 4 bytes read
+ */
+uint8_t tea5767_telemetry_sample(tea5767_telemetry_t *telemetry, uint32_t ms);
+
+/**
+ * @brief     take a sample when it is due
+ * @param[in] *telemetry pointer to a tea5767 telemetry structure
+ * @param[in] ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 telemetry is NULL
+ *            - 3 telemetry is not initialized
+ * @note      call it at least once per period, samples missed by a late call are skipped instead of bursting
+ */
+uint8_t tea5767_telemetry_poll(tea5767_telemetry_t *telemetry, uint32_t ms);
+
+/**
+ * @brief      subscribe to a ring
+ * @param[in]  *ring pointer to a sample ring
+ * @param[out] *reader pointer to a reader structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring or reader is NULL
+ * @note       the reader starts with the next sample, any number of readers can subscribe
+ */
+uint8_t tea5767_telemetry_subscribe(tea5767_telemetry_ring_t *ring, tea5767_telemetry_reader_t *reader);
+
+/**
+ * @brief         read the next sample
+ * @param[in]     *ring pointer to a sample ring
+ * @param[in,out] *reader pointer to a reader structure
+ * @param[out]    *sample pointer to a sample buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no new sample
+ *                - 2 ring, reader or sample is NULL
+ * @note          lock free, a slow reader skips the overwritten samples and counts them as lost
+ */
+uint8_t tea5767_telemetry_read(tea5767_telemetry_ring_t *ring, tea5767_telemetry_reader_t *reader, tea5767_telemetry_sample_t *sample);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
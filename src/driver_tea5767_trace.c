@@ -0,0 +1,394 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_trace.c
+ * @brief     driver tea5767 trace source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_trace.h"
+
+/**
+ * @brief     latch written bytes into the registers
+ * @param[in] *reg pointer to a register buffer
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @note      bytes are latched in order, so a short write keeps the tail registers
+ */
+static void a_tea5767_trace_latch(uint8_t reg[5], const uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    for (i = 0; (i < len) && (i < 5); i++)     /* all written registers */
+    {
+        reg[i] = buf[i];                       /* latch the byte */
+    }
+}
+
+/**
+ * @brief     get the next record of a replay
+ * @param[in] *replay pointer to a tea5767 trace replay structure
+ * @param[in] dir transfer direction
+ * @return    pointer to the next record, NULL means mismatch
+ * @note      none
+ */
+static const tea5767_trace_record_t *a_tea5767_trace_next(tea5767_trace_replay_t *replay, uint8_t dir)
+{
+    const tea5767_trace_record_t *record;
+    
+    if (replay->pos >= replay->num)            /* check the end */
+    {
+        replay->mismatch++;                    /* transfer after the trace */
+        
+        return NULL;                           /* return error */
+    }
+    record = &replay->record[replay->pos];     /* get the record */
+    if (record->dir != dir)                    /* check the direction */
+    {
+        replay->mismatch++;                    /* other direction */
+        
+        return NULL;                           /* return error */
+    }
+    replay->pos++;                             /* consume the record */
+    
+    return record;                             /* return the record */
+}
+
+/**
+ * @brief     replay the written bytes of a record
+ * @param[in] *replay pointer to a tea5767 trace replay structure
+ * @param[in] *record pointer to a record
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @note      none
+ */
+static void a_tea5767_trace_replay_write(tea5767_trace_replay_t *replay, const tea5767_trace_record_t *record,
+                                         const uint8_t *buf, uint16_t len)
+{
+    uint8_t wnum;
+    
+    wnum = (record->wlen > TEA5767_TRACE_DATA_SIZE) ? TEA5767_TRACE_DATA_SIZE : record->wlen;     /* stored written bytes */
+    a_tea5767_trace_latch(replay->reg, buf, len);                                                 /* latch the replayed write */
+    a_tea5767_trace_latch(replay->expect, record->data, wnum);                                    /* latch the captured write */
+    if (memcmp(replay->reg, replay->expect, 5) != 0)                                              /* check the registers */
+    {
+        replay->mismatch++;                                                                       /* other registers */
+        memcpy(replay->reg, replay->expect, 5);                                                   /* follow the trace */
+    }
+}
+
+/**
+ * @brief      replay the read bytes of a record
+ * @param[in]  *replay pointer to a tea5767 trace replay structure
+ * @param[in]  *record pointer to a record
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @note       bytes that are not in the record read as 0
+ */
+static void a_tea5767_trace_replay_read(tea5767_trace_replay_t *replay, const tea5767_trace_record_t *record,
+                                        uint8_t *buf, uint16_t len)
+{
+    uint8_t wnum;
+    uint8_t rnum;
+    
+    wnum = (record->wlen > TEA5767_TRACE_DATA_SIZE) ? TEA5767_TRACE_DATA_SIZE : record->wlen;     /* stored written bytes */
+    rnum = (record->rlen > (TEA5767_TRACE_DATA_SIZE - wnum)) ? 
+           (TEA5767_TRACE_DATA_SIZE - wnum) : record->rlen;                                       /* stored read bytes */
+    if (len != record->rlen)                                                                      /* check the length */
+    {
+        replay->mismatch++;                                                                       /* other length */
+    }
+    memset(buf, 0, len);                                                                          /* clear the buffer */
+    memcpy(buf, &record->data[wnum], (len < rnum) ? len : rnum);                                  /* copy the read bytes */
+}
+
+/**
+ * @brief     initialize the trace
+ * @param[in] *trace pointer to a tea5767 trace structure
+ * @param[in] *record pointer to a preallocated record ring
+ * @param[in] size record ring size
+ * @param[in] *clock_us pointer to a clock_us function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace is NULL
+ *            - 4 record or clock_us is NULL
+ *            - 5 size is not a power of 2
+ * @note      link the trace to a handle with DRIVER_TEA5767_LINK_TRACE to start recording
+ */
+uint8_t tea5767_trace_init(tea5767_trace_t *trace, tea5767_trace_record_t *record, uint32_t size, uint32_t (*clock_us)(void))
+{
+    if (trace == NULL)                                 /* check trace */
+    {
+        return 2;                                      /* return error */
+    }
+    if ((record == NULL) || (clock_us == NULL))        /* check record and clock_us */
+    {
+        return 4;                                      /* return error */
+    }
+    if ((size == 0) || ((size & (size - 1)) != 0))     /* check the size */
+    {
+        return 5;                                      /* return error */
+    }
+    
+    trace->clock_us = clock_us;                        /* set the clock */
+    trace->record = record;                            /* set the ring */
+    trace->size = size;                                /* set the size */
+    trace->head = 0;                                   /* clear the ring */
+    
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief     clear the trace
+ * @param[in] *trace pointer to a tea5767 trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace is NULL
+ * @note      none
+ */
+uint8_t tea5767_trace_clear(tea5767_trace_t *trace)
+{
+    if (trace == NULL)     /* check trace */
+    {
+        return 2;          /* return error */
+    }
+    
+    trace->head = 0;       /* clear the ring */
+    
+    return 0;              /* success return 0 */
+}
+
+/**
+ * @brief      get the blob header of the trace
+ * @param[in]  *trace pointer to a tea5767 trace structure
+ * @param[out] *header pointer to a header buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trace or header is NULL
+ * @note       none
+ */
+uint8_t tea5767_trace_get_header(tea5767_trace_t *trace, tea5767_trace_header_t *header)
+{
+    if ((trace == NULL) || (header == NULL))                                   /* check trace and header */
+    {
+        return 2;                                                              /* return error */
+    }
+    
+    header->magic = TEA5767_TRACE_MAGIC;                                       /* set the magic */
+    header->version = TEA5767_TRACE_VERSION;                                   /* set the version */
+    header->record_size = sizeof(tea5767_trace_record_t);                      /* set the record size */
+    header->num = (trace->head > trace->size) ? trace->size : trace->head;     /* set the record number */
+    header->lost = trace->head - header->num;                                  /* set the overwritten number */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      get a record of the trace
+ * @param[in]  *trace pointer to a tea5767 trace structure
+ * @param[in]  index record index, 0 is the oldest record
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trace or record is NULL
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t tea5767_trace_get_record(tea5767_trace_t *trace, uint32_t index, tea5767_trace_record_t *record)
+{
+    uint32_t num;
+    
+    if ((trace == NULL) || (record == NULL))                           /* check trace and record */
+    {
+        return 2;                                                      /* return error */
+    }
+    num = (trace->head > trace->size) ? trace->size : trace->head;     /* get the record number */
+    if (index >= num)                                                  /* check the index */
+    {
+        return 4;                                                      /* return error */
+    }
+    
+    *record = trace->record[(trace->head - num + index) & (trace->size - 1)]; /* copy the record */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     check a loaded trace blob
+ * @param[in] *header pointer to a blob header
+ * @param[in] len loaded blob length
+ * @return    status code
+ *            - 0 success
+ *            - 2 header is NULL
+ *            - 4 len is invalid
+ *            - 5 magic, version or record size is invalid
+ * @note      the records follow the header
+ */
+uint8_t tea5767_trace_check(const tea5767_trace_header_t *header, uint32_t len)
+{
+    if (header == NULL)                                                                            /* check header */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (len < sizeof(tea5767_trace_header_t))                                                      /* check the header length */
+    {
+        return 4;                                                                                  /* return error */
+    }
+    if ((header->magic != TEA5767_TRACE_MAGIC) || 
+        (header->version != TEA5767_TRACE_VERSION) || 
+        (header->record_size != sizeof(tea5767_trace_record_t)))                                   /* check the header */
+    {
+        return 5;                                                                                  /* return error */
+    }
+    if (header->num > (len - sizeof(tea5767_trace_header_t)) / sizeof(tea5767_trace_record_t))     /* check the records */
+    {
+        return 4;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     initialize a replay bus
+ * @param[in] *replay pointer to a tea5767 trace replay structure
+ * @param[in] *record pointer to the captured records
+ * @param[in] num record number
+ * @return    status code
+ *            - 0 success
+ *            - 2 replay is NULL
+ *            - 4 record is NULL
+ * @note      link the replay with DRIVER_TEA5767_LINK_BUS_CTX and the replay iic ctx commands
+ */
+uint8_t tea5767_trace_replay_init(tea5767_trace_replay_t *replay, const tea5767_trace_record_t *record, uint32_t num)
+{
+    if (replay == NULL)                                    /* check replay */
+    {
+        return 2;                                          /* return error */
+    }
+    if (record == NULL)                                    /* check record */
+    {
+        return 4;                                          /* return error */
+    }
+    
+    memset(replay, 0, sizeof(tea5767_trace_replay_t));     /* clear the replay */
+    replay->record = record;                               /* set the records */
+    replay->num = num;                                     /* set the record number */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      replay bus read command
+ * @param[in]  *ctx pointer to a tea5767 trace replay structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the captured bytes and the captured bus result are returned,
+ *             a transfer that does not match the next record fails and is counted as mismatch
+ */
+uint8_t tea5767_trace_replay_read(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    tea5767_trace_replay_t *replay;
+    const tea5767_trace_record_t *record;
+    
+    (void)addr;                                                        /* one device on the replay bus */
+    replay = (tea5767_trace_replay_t *)ctx;                            /* get the replay */
+    record = a_tea5767_trace_next(replay, TEA5767_TRACE_DIR_READ);     /* get the next record */
+    if (record == NULL)                                                /* check the record */
+    {
+        return 1;                                                      /* return error */
+    }
+    a_tea5767_trace_replay_read(replay, record, buf, len);             /* replay the read */
+    
+    return (record->res != 0) ? 1 : 0;                                 /* return the captured result */
+}
+
+/**
+ * @brief     replay bus write command
+ * @param[in] *ctx pointer to a tea5767 trace replay structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      writes are compared by the latched registers, so a shorter prefix write with the same result matches
+ */
+uint8_t tea5767_trace_replay_write(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    tea5767_trace_replay_t *replay;
+    const tea5767_trace_record_t *record;
+    
+    (void)addr;                                                         /* one device on the replay bus */
+    replay = (tea5767_trace_replay_t *)ctx;                             /* get the replay */
+    record = a_tea5767_trace_next(replay, TEA5767_TRACE_DIR_WRITE);     /* get the next record */
+    if (record == NULL)                                                 /* check the record */
+    {
+        return 1;                                                       /* return error */
+    }
+    a_tea5767_trace_replay_write(replay, record, buf, len);             /* replay the write */
+    
+    return (record->res != 0) ? 1 : 0;                                  /* return the captured result */
+}
+
+/**
+ * @brief      replay bus write read command
+ * @param[in]  *ctx pointer to a tea5767 trace replay structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
+ */
+uint8_t tea5767_trace_replay_write_read(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    tea5767_trace_replay_t *replay;
+    const tea5767_trace_record_t *record;
+    
+    (void)addr;                                                              /* one device on the replay bus */
+    replay = (tea5767_trace_replay_t *)ctx;                                  /* get the replay */
+    record = a_tea5767_trace_next(replay, TEA5767_TRACE_DIR_WRITE_READ);     /* get the next record */
+    if (record == NULL)                                                      /* check the record */
+    {
+        return 1;                                                            /* return error */
+    }
+    a_tea5767_trace_replay_write(replay, record, wbuf, wlen);                /* replay the write */
+    a_tea5767_trace_replay_read(replay, record, rbuf, rlen);                 /* replay the read */
+    
+    return (record->res != 0) ? 1 : 0;                                       /* return the captured result */
+}
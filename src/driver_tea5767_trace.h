@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_trace.h
+ * @brief     driver tea5767 trace header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_TRACE_H
+#define DRIVER_TEA5767_TRACE_H
+
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup tea5767_trace_driver tea5767 trace driver function
+ * @brief    tea5767 trace driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+/**
+ * @brief tea5767 trace blob definition
+ */
+#define TEA5767_TRACE_MAGIC          0x35435254UL        /**< "TRC5" */
+#define TEA5767_TRACE_VERSION        0x0001              /**< blob version */
+
+/**
+ * @brief tea5767 trace blob header structure definition
+ * @note  a trace blob is the header followed by num records, oldest first
+ */
+typedef struct tea5767_trace_header_s
+{
+    uint32_t magic;                /**< blob magic */
+    uint16_t version;              /**< blob version */
+    uint16_t record_size;          /**< size of one record */
+    uint32_t num;                  /**< record number */
+    uint32_t lost;                 /**< overwritten record number */
+} tea5767_trace_header_t;
+
+/**
+ * @brief tea5767 trace replay structure definition
+ */
+typedef struct tea5767_trace_replay_s
+{
+    const tea5767_trace_record_t *record;        /**< captured records */
+    uint32_t num;                                /**< record number */
+    uint32_t pos;                                /**< next record */
+    uint32_t mismatch;                           /**< transfers that differ from the trace */
+    uint8_t reg[5];                              /**< registers latched by the replayed writes */
+    uint8_t expect[5];                           /**< registers latched by the captured writes */
+} tea5767_trace_replay_t;
+
+/**
+ * @brief     initialize the trace
+ * @param[in] *trace pointer to a tea5767 trace structure
+ * @param[in] *record pointer to a preallocated record ring
+ * @param[in] size record ring size
+ * @param[in] *clock_us pointer to a clock_us function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace is NULL
+ *            - 4 record or clock_us is NULL
+ *            - 5 size is not a power of 2
+ * @note      link the trace to a handle with DRIVER_TEA5767_LINK_TRACE to start recording
+ */
+uint8_t tea5767_trace_init(tea5767_trace_t *trace, tea5767_trace_record_t *record, uint32_t size, uint32_t (*clock_us)(void));
+
+/**
+ * @brief     clear the trace
+ * @param[in] *trace pointer to a tea5767 trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace is NULL
+ * @note      none
+ */
+uint8_t tea5767_trace_clear(tea5767_trace_t *trace);
+
+/**
+ * @brief      get the blob header of the trace
+ * @param[in]  *trace pointer to a tea5767 trace structure
+ * @param[out] *header pointer to a header buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trace or header is NULL
+ * @note       none
+ */
+uint8_t tea5767_trace_get_header(tea5767_trace_t *trace, tea5767_trace_header_t *header);
+
+/**
+ * @brief      get a record of the trace
+ * @param[in]  *trace pointer to a tea5767 trace structure
+ * @param[in]  index record index, 0 is the oldest record
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trace or record is NULL
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t tea5767_trace_get_record(tea5767_trace_t *trace, uint32_t index, tea5767_trace_record_t *record);
+
+/**
+ * @brief     check a loaded trace blob
+ * @param[in] *header pointer to a blob header
+ * @param[in] len loaded blob length
+ * @return    status code
+ *            - 0 success
+ *            - 2 header is NULL
+ *            - 4 len is invalid
+ *            - 5 magic, version or record size is invalid
+ * @note      the records follow the header
+ */
+uint8_t tea5767_trace_check(const tea5767_trace_header_t *header, uint32_t len);
+
+/**
+ * @brief     initialize a replay bus
+ * @param[in] *replay pointer to a tea5767 trace replay structure
+ * @param[in] *record pointer to the captured records
+ * @param[in] num record number
+ * @return    status code
+ *            - 0 success
+ *            - 2 replay is NULL
+ *            - 4 record is NULL
+ * @note      link the replay with DRIVER_TEA5767_LINK_BUS_CTX and the replay iic ctx commands
+ */
+uint8_t tea5767_trace_replay_init(tea5767_trace_replay_t *replay, const tea5767_trace_record_t *record, uint32_t num);
+
+/**
+ * @brief      replay bus read command
+ * @param[in]  *ctx pointer to a tea5767 trace replay structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the captured bytes and the captured bus result are returned,
+ *             a transfer that does not match the next record fails and is counted as mismatch
+ */
+uint8_t tea5767_trace_replay_read(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     replay bus write command
+ * @param[in] *ctx pointer to a tea5767 trace replay structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      writes are compared by the latched registers, so a shorter prefix write with the same result matches
+ */
+uint8_t tea5767_trace_replay_write(void *ctx, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      replay bus write read command
+ * @param[in]  *ctx pointer to a tea5767 trace replay structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
+ */
+uint8_t tea5767_trace_replay_write_read(void *ctx, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_afc_test.c
+ * @brief     driver tea5767 afc test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_afc_test.h"
+
+static tea5767_handle_t gs_handle;        /**< tea5767 handle */
+
+/**
+ * @brief  afc test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a station is detuned by 5 pll steps and the afc must pull it back into the if window
+ */
+uint8_t tea5767_afc_test(void)
+{
+    uint8_t res;
+    uint8_t if_out;
+    uint16_t pll;
+    uint16_t station_pll;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    
+    /* start afc test */
+    tea5767_interface_debug_print("tea5767: start afc test.\n");
+    
+    /* tea5767 init */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* detune 88.7MHz by 5 pll steps */
+    (void)tea5767_set_mute(&gs_handle, TEA5767_BOOL_FALSE);
+    (void)tea5767_set_mode(&gs_handle, TEA5767_MODE_NORMAL);
+    (void)tea5767_set_band(&gs_handle, TEA5767_BAND_US_EUROPE);
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_side_injection(&gs_handle, TEA5767_SIDE_INJECTION_LOW);
+    res = tea5767_khz_to_pll(&gs_handle, 88700, &station_pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: khz to pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)tea5767_set_pll(&gs_handle, station_pll - 5);
+    res = tea5767_flush_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: flush conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    tea5767_interface_delay_ms(100);
+    
+    /* read if */
+    res = tea5767_read_if(&gs_handle, &if_out);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read if failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: detuned pll is 0x%04X, if is 0x%02X.\n", station_pll - 5, if_out);
+    
+    /* afc */
+    res = tea5767_afc(&gs_handle, &if_out);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: afc failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* get pll */
+    res = tea5767_get_pll(&gs_handle, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: get pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: afc pll is 0x%04X, if is 0x%02X.\n", pll, if_out);
+    
+    /* check the if window */
+    if ((if_out < 0x31) || (if_out > 0x3E))
+    {
+        tea5767_interface_debug_print("tea5767: if 0x%02X is out of the window.\n", if_out);
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish afc test */
+    tea5767_interface_debug_print("tea5767: finish afc test.\n");
+    (void)tea5767_deinit(&gs_handle);
+    
+    return 0;
+}
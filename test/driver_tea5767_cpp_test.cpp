@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_cpp_test.cpp
+ * @brief     driver tea5767 c++ test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767.hpp"
+#include "driver_tea5767_simulator.h"
+#include <cstdarg>
+#include <cstdio>
+
+/**
+ * @brief tea5767 simulator device type definition
+ */
+using sim_device = tea5767::device<tea5767::function_transport<tea5767_simulator_iic_read_cmd,
+                                                               tea5767_simulator_iic_write_cmd>>;
+
+/* the map must match the bits of the c setters */
+static_assert(tea5767::conf_up::pll::mask_of(0) == 0x3F, "pll high is wrong");
+static_assert(tea5767::conf_up::pll::mask_of(1) == 0xFF, "pll low is wrong");
+static_assert(tea5767::conf_up::clock::mask_of(3) == 0x10, "xtal is wrong");
+static_assert(tea5767::conf_up::clock::mask_of(4) == 0x80, "pllref is wrong");
+static_assert(tea5767::conf_up::clock::bits_of(4, TEA5767_CLOCK_13_MHZ) == 0x00, "13MHz is wrong");
+static_assert(tea5767::conf_up::clock::bits_of(3, TEA5767_CLOCK_32P768_KHZ) == 0x10, "32.768KHz is wrong");
+static_assert(tea5767::conf_up::search_stop_level::mask_of(2) == 0x60, "search stop level is wrong");
+
+#ifdef TEA5767_CPP_TEST_OVERLAP
+/**
+ * @brief tea5767 overlapping field definition
+ * @note  a 7 bits pll high covers the search mode bit, the update below must not compile
+ */
+using wrong_pll = tea5767::field<std::uint16_t, tea5767::part<0, 0, 7, 8>, tea5767::part<1, 0, 8>>;
+
+/**
+ * @brief     set overlapping fields
+ * @param[in] *dev pointer to a device
+ * @note      fails with "fields overlap"
+ */
+void tea5767_cpp_test_overlap(sim_device *dev)
+{
+    dev->update<tea5767::conf_up::mode, wrong_pll>(TEA5767_MODE_NORMAL, 0x2A30);
+}
+#else
+
+/**
+ * @brief     print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_cpp_test_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief  c++ test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the c++ layer powers up the simulator on 88.7MHz, the conf must match the one of the c setters
+ *         and the read status must show the tuned station
+ */
+int main(void)
+{
+    tea5767_handle_t handle;
+    sim_device dev;
+    std::uint16_t pll;
+    std::uint8_t if_out;
+    std::uint8_t i;
+    
+    /* the c driver gives the pll and the reference conf */
+    DRIVER_TEA5767_LINK_INIT(&handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&handle, tea5767_simulator_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&handle, tea5767_simulator_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&handle, tea5767_simulator_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&handle, tea5767_simulator_iic_write_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&handle, tea5767_simulator_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&handle, a_cpp_test_debug_print);
+    if (tea5767_init(&handle) != 0)
+    {
+        (void)printf("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    (void)tea5767_set_band(&handle, TEA5767_BAND_US_EUROPE);
+    (void)tea5767_set_clock(&handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_side_injection(&handle, TEA5767_SIDE_INJECTION_LOW);
+    (void)tea5767_set_mode(&handle, TEA5767_MODE_NORMAL);
+    (void)tea5767_set_search_stop_level(&handle, TEA5767_SEARCH_STOP_LEVEL_MID);
+    (void)tea5767_set_channel(&handle, TEA5767_CHANNEL_STEREO);
+    (void)tea5767_set_high_cut_control(&handle, TEA5767_BOOL_TRUE);
+    (void)tea5767_set_stereo_noise_cancelling(&handle, TEA5767_BOOL_TRUE);
+    if (tea5767_khz_to_pll(&handle, 88700, &pll) != 0)
+    {
+        (void)printf("tea5767: khz to pll failed.\n");
+        
+        return 1;
+    }
+    (void)tea5767_set_pll(&handle, pll);
+    
+    /* start c++ test */
+    (void)printf("tea5767: start c++ test.\n");
+    
+    /* power up */
+    if (dev.init(TEA5767_CLOCK_32P768_KHZ, TEA5767_BAND_US_EUROPE, pll) != 0)
+    {
+        (void)printf("tea5767: device init failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < tea5767::conf_size; i++)
+    {
+        if (dev.conf()[i] != handle.conf_up[i])
+        {
+            (void)printf("tea5767: conf byte %d is 0x%02X, but 0x%02X is expected.\n", i, dev.conf()[i], handle.conf_up[i]);
+            
+            return 1;
+        }
+    }
+    (void)printf("tea5767: conf is %02X %02X %02X %02X %02X.\n", 
+                 dev.conf()[0], dev.conf()[1], dev.conf()[2], dev.conf()[3], dev.conf()[4]);
+    
+    /* read the tuned station */
+    tea5767_simulator_delay_ms(100);
+    if (dev.read_status() != 0)
+    {
+        (void)printf("tea5767: read status failed.\n");
+        
+        return 1;
+    }
+    if_out = dev.status<tea5767::conf_down::if_out>();
+    (void)printf("tea5767: pll is 0x%04X, if is 0x%02X, level is 0x%02X.\n", 
+                 dev.status<tea5767::conf_down::searched_pll>(), if_out, 
+                 dev.status<tea5767::conf_down::level_adc_output>());
+    if ((dev.status<tea5767::conf_down::ready_flag>() != TEA5767_BOOL_TRUE) || 
+        (dev.status<tea5767::conf_down::searched_pll>() != pll) || (if_out < 0x31) || (if_out > 0x3E))
+    {
+        (void)printf("tea5767: station is not tuned.\n");
+        
+        return 1;
+    }
+    
+    /* flush one field */
+    dev.set<tea5767::conf_up::mute>(TEA5767_BOOL_TRUE);
+    if ((dev.flush_conf() != 0) || (dev.get<tea5767::conf_up::mute>() != TEA5767_BOOL_TRUE))
+    {
+        (void)printf("tea5767: flush conf failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish c++ test */
+    (void)printf("tea5767: finish c++ test.\n");
+    
+    return 0;
+}
+#endif
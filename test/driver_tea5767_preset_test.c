@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_preset_test.c
+ * @brief     driver tea5767 preset test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_preset_test.h"
+
+static tea5767_handle_t gs_handle;              /**< tea5767 handle */
+static tea5767_preset_store_t gs_preset;        /**< preset store */
+
+/**
+ * @brief  preset test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a tuned station is saved, the chip is tuned away with another clock and the recalled pll and clock must be the saved ones,
+ *         a corrupted blob must fail the check
+ */
+uint8_t tea5767_preset_test(void)
+{
+    uint8_t res;
+    uint16_t pll;
+    tea5767_clock_t clk;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    
+    /* start preset test */
+    tea5767_interface_debug_print("tea5767: start preset test.\n");
+    
+    /* tea5767 init */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* tune 88.7MHz */
+    (void)tea5767_set_mute(&gs_handle, TEA5767_BOOL_FALSE);
+    (void)tea5767_set_mode(&gs_handle, TEA5767_MODE_NORMAL);
+    (void)tea5767_set_band(&gs_handle, TEA5767_BAND_US_EUROPE);
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_side_injection(&gs_handle, TEA5767_SIDE_INJECTION_LOW);
+    res = tea5767_khz_to_pll(&gs_handle, 88700, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: khz to pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)tea5767_set_pll(&gs_handle, pll);
+    res = tea5767_write_read_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: write read conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* preset init */
+    res = tea5767_preset_init(&gs_preset);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: preset init failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* save the tuned station */
+    res = tea5767_preset_save(&gs_handle, &gs_preset, 0);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: preset save failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the blob */
+    res = tea5767_preset_check(&gs_preset, sizeof(gs_preset));
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: preset check failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: preset blob is %d bytes, pll is 0x%04X.\n", 
+                                  (int)sizeof(gs_preset), gs_preset.record[0].pll);
+    
+    /* tune away with another clock */
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_13_MHZ);
+    (void)tea5767_set_pll(&gs_handle, 0x2A00);
+    res = tea5767_flush_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: flush conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* recall the station */
+    res = tea5767_preset_recall(&gs_handle, &gs_preset, 0);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: preset recall failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the recalled clock */
+    res = tea5767_get_clock(&gs_handle, &clk);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: get clock failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (clk != TEA5767_CLOCK_32P768_KHZ)
+    {
+        tea5767_interface_debug_print("tea5767: recalled clock is wrong.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 100ms */
+    tea5767_interface_delay_ms(100);
+    
+    /* read the tuned pll */
+    res = tea5767_read_searched_pll(&gs_handle, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read searched pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (pll != gs_preset.record[0].pll)
+    {
+        tea5767_interface_debug_print("tea5767: recalled pll is 0x%04X, but 0x%04X is expected.\n", pll, gs_preset.record[0].pll);
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: recalled pll is 0x%04X.\n", pll);
+    
+    /* corrupt the blob */
+    gs_preset.record[0].level ^= 0x01;
+    res = tea5767_preset_check(&gs_preset, sizeof(gs_preset));
+    if (res != 1)
+    {
+        tea5767_interface_debug_print("tea5767: corrupted preset is not detected.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish preset test */
+    tea5767_interface_debug_print("tea5767: finish preset test.\n");
+    (void)tea5767_deinit(&gs_handle);
+    
+    return 0;
+}
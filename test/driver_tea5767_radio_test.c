@@ -35,9 +35,13 @@
  */
  
 #include "driver_tea5767_radio_test.h"
+#ifdef TEA5767_SIMULATOR
+#include "driver_tea5767_simulator.h"
+#endif
 #include <stdlib.h>
 
-static tea5767_handle_t gs_handle;        /**< tea5767 handle */
+static tea5767_handle_t gs_handle;             /**< tea5767 handle */
+static tea5767_station_t gs_station[32];       /**< station table */
 
 /**
  * @brief     radio test
@@ -51,6 +55,12 @@ uint8_t tea5767_radio_test(tea5767_clock_t clk)
 {
     uint8_t res;
     uint8_t output;
+    uint16_t i;
+    uint16_t num;
+#ifdef TEA5767_SIMULATOR
+    uint8_t j;
+    tea5767_simulator_t *sim;
+#endif
     uint16_t pll;
     float mhz;
     tea5767_reception_t reception;
@@ -64,6 +74,7 @@ uint8_t tea5767_radio_test(tea5767_clock_t clk)
     DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
     DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
     DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
     DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
     DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
     
@@ -291,11 +302,11 @@ uint8_t tea5767_radio_test(tea5767_clock_t clk)
         return 1;
     }
     
-    /* write conf */
-    res = tea5767_write_conf(&gs_handle);
+    /* write conf and read the first status in one transaction */
+    res = tea5767_write_read_conf(&gs_handle);
     if (res != 0)
     {
-        tea5767_interface_debug_print("tea5767: write conf failed.\n");
+        tea5767_interface_debug_print("tea5767: write read conf failed.\n");
         (void)tea5767_deinit(&gs_handle);
        
         return 1;
@@ -304,16 +315,6 @@ uint8_t tea5767_radio_test(tea5767_clock_t clk)
     /* wait searched */
     while (1)
     {
-        /* read conf */
-        res = tea5767_read_conf(&gs_handle);
-        if (res != 0)
-        {
-            tea5767_interface_debug_print("tea5767: read conf failed.\n");
-            (void)tea5767_deinit(&gs_handle);
-           
-            return 1;
-        }
-        
         /* read ready flag */
         res = tea5767_get_ready_flag(&gs_handle, &ready_flag);
         if (res != 0)
@@ -342,6 +343,16 @@ uint8_t tea5767_radio_test(tea5767_clock_t clk)
         
         /* delay 500ms */
         tea5767_interface_delay_ms(500);
+        
+        /* read conf */
+        res = tea5767_read_conf(&gs_handle);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: read conf failed.\n");
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
     }
     if (limit_flag == TEA5767_BOOL_TRUE)
     {
@@ -421,6 +432,75 @@ uint8_t tea5767_radio_test(tea5767_clock_t clk)
     tea5767_interface_debug_print("tea5767: play 20s.\n");
     tea5767_interface_delay_ms(20000);
     
+    /* scan the band */
+    tea5767_interface_debug_print("tea5767: scan the band.\n");
+    res = tea5767_scan(&gs_handle, TEA5767_SCAN_MODE_SEARCH, gs_station, 32, &num);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: scan failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: found %d stations.\n", num);
+    for (i = 0; i < num; i++)
+    {
+        tea5767_interface_debug_print("tea5767: %dKHz pll 0x%04X level 0x%02X if 0x%02X %s.\n", 
+                                      gs_station[i].khz, gs_station[i].pll, gs_station[i].level, gs_station[i].if_out, 
+                                      (gs_station[i].reception == TEA5767_RECEPTION_MONO) ? "mono" : "stereo");
+    }
+#ifdef TEA5767_SIMULATOR
+    
+    /* check the found stations against the simulated band */
+    sim = tea5767_simulator_get_default();
+    for (i = 0; i < num; i++)
+    {
+        for (j = 0; j < sim->station_num; j++)
+        {
+            if (sim->station[j].khz == gs_station[i].khz)
+            {
+                break;
+            }
+        }
+        if (j == sim->station_num)
+        {
+            tea5767_interface_debug_print("tea5767: %dKHz is not a simulated station.\n", gs_station[i].khz);
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    if (num == 0)
+    {
+        tea5767_interface_debug_print("tea5767: no station found.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+#endif
+    
+    /* a running scan must refuse a second start */
+    res = tea5767_scan_start(&gs_handle, TEA5767_SCAN_MODE_SEARCH, gs_station, 32, 0);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: scan start failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = tea5767_scan_start(&gs_handle, TEA5767_SCAN_MODE_SEARCH, gs_station, 32, 0);
+    (void)tea5767_scan_stop(&gs_handle);
+    if (res != 4)
+    {
+        tea5767_interface_debug_print("tea5767: busy scan start is not refused.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    tea5767_interface_debug_print("tea5767: busy scan start is refused.\n");
+    
     /* finish radio test */
     tea5767_interface_debug_print("tea5767: finish radio test.\n");  
     (void)tea5767_deinit(&gs_handle);
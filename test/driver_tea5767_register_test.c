@@ -39,6 +39,34 @@
 
 static tea5767_handle_t gs_handle;        /**< tea5767 handle */
 
+/**
+ * @brief      wait for the async transfer
+ * @param[out] *status pointer to an async status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait timeout
+ * @note       none
+ */
+static uint8_t a_tea5767_async_wait(tea5767_async_status_t *status)
+{
+    uint32_t ms;
+    
+    for (ms = 0; ms < 100; ms++)
+    {
+        if (tea5767_get_async_status(&gs_handle, status) != 0)
+        {
+            return 1;
+        }
+        if ((*status) != TEA5767_ASYNC_STATUS_BUSY)
+        {
+            return 0;
+        }
+        tea5767_interface_delay_ms(1);
+    }
+    
+    return 1;
+}
+
 /**
  * @brief  register test
  * @return status code
@@ -52,6 +80,9 @@ uint8_t tea5767_register_test(void)
     uint8_t output;
     uint16_t pll;
     uint16_t pll_check;
+    uint16_t index;
+    uint32_t khz;
+    uint32_t khz_check;
     float mhz;
     float mhz_check;
     tea5767_info_t info;
@@ -66,6 +97,8 @@ uint8_t tea5767_register_test(void)
     tea5767_de_emphasis_t emphasis;
     tea5767_clock_t clk;
     tea5767_reception_t reception;
+    tea5767_async_status_t async_status;
+    tea5767_status_t status;
     
     /* link functions */
     DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
@@ -73,6 +106,9 @@ uint8_t tea5767_register_test(void)
     DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
     DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
     DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_READ_SUBMIT(&gs_handle, tea5767_interface_iic_read_submit);
+    DRIVER_TEA5767_LINK_IIC_WRITE_SUBMIT(&gs_handle, tea5767_interface_iic_write_submit);
     DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
     DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
     
@@ -1114,15 +1150,107 @@ uint8_t tea5767_register_test(void)
         return 1;
     }
     
+    /* tea5767_flush_conf test */
+    tea5767_interface_debug_print("tea5767: tea5767_flush_conf test.\n");
+    
+    /* flush conf */
+    res = tea5767_flush_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: flush conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    tea5767_interface_debug_print("tea5767: check flush conf ok.\n");
+    
+    /* tea5767_write_read_conf test */
+    tea5767_interface_debug_print("tea5767: tea5767_write_read_conf test.\n");
+    
+    /* write read conf */
+    res = tea5767_write_read_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: write read conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+       
+        return 1;
+    }
+    tea5767_interface_debug_print("tea5767: check write read conf ok.\n");
+    
+    /* tea5767_write_conf_async/tea5767_read_conf_async test */
+    tea5767_interface_debug_print("tea5767: tea5767_write_conf_async/tea5767_read_conf_async test.\n");
+    
+    /* write conf async */
+    res = tea5767_write_conf_async(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: write conf async failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* wait the write */
+    res = a_tea5767_async_wait(&async_status);
+    if ((res != 0) || (async_status != TEA5767_ASYNC_STATUS_DONE))
+    {
+        tea5767_interface_debug_print("tea5767: write conf async timeout.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* read conf async */
+    res = tea5767_read_conf_async(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read conf async failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* wait the read */
+    res = a_tea5767_async_wait(&async_status);
+    if ((res != 0) || (async_status != TEA5767_ASYNC_STATUS_DONE))
+    {
+        tea5767_interface_debug_print("tea5767: read conf async timeout.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* get the async read pll */
+    res = tea5767_get_searched_pll(&gs_handle, &pll_check);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: get searched pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* read conf */
     res = tea5767_read_conf(&gs_handle);
     if (res != 0)
     {
         tea5767_interface_debug_print("tea5767: read conf failed.\n");
         (void)tea5767_deinit(&gs_handle);
-       
+        
+        return 1;
+    }
+    
+    /* get the read pll */
+    res = tea5767_get_searched_pll(&gs_handle, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: get searched pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
         return 1;
     }
+    tea5767_interface_debug_print("tea5767: check async conf %s.\n", (pll_check == pll) ? "ok" : "error");
     
     /* tea5767_get_ready_flag test */
     tea5767_interface_debug_print("tea5767: tea5767_get_ready_flag test.\n");
@@ -1220,6 +1348,162 @@ uint8_t tea5767_register_test(void)
     /* output */
     tea5767_interface_debug_print("tea5767: level adc output is 0x%02X.\n", output);
     
+    /* tea5767_read_status test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_status test.\n");
+    
+    /* read status */
+    res = tea5767_read_status(&gs_handle, 1);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read status failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: read 1 byte status.\n");
+    
+    /* tea5767_read_status_snapshot test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_status_snapshot test.\n");
+    
+    /* read status snapshot */
+    res = tea5767_read_status_snapshot(&gs_handle, &status);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read status snapshot failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the decode against the getters */
+    (void)tea5767_get_searched_pll(&gs_handle, &pll_check);
+    (void)tea5767_get_if(&gs_handle, &output);
+    (void)tea5767_get_reception(&gs_handle, &reception);
+    (void)tea5767_get_ready_flag(&gs_handle, &enable);
+    if ((status.pll != pll_check) || (status.if_out != output) || 
+        (status.reception != reception) || (status.ready != enable))
+    {
+        tea5767_interface_debug_print("tea5767: status snapshot mismatch.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)tea5767_get_band_limit_flag(&gs_handle, &enable);
+    (void)tea5767_get_level_adc_output(&gs_handle, &output);
+    if (tea5767_pll_to_khz(&gs_handle, pll_check, &khz_check) != 0)
+    {
+        khz_check = 0;
+    }
+    if ((status.band_limit != enable) || (status.level != output) || (status.khz != khz_check))
+    {
+        tea5767_interface_debug_print("tea5767: status snapshot mismatch.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: pll 0x%04X %dKHz level 0x%02X if 0x%02X %s.\n", status.pll, status.khz, 
+                                  status.level, status.if_out, (status.reception == TEA5767_RECEPTION_MONO) ? "mono" : "stereo");
+    
+    /* tea5767_read_ready_flag test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_ready_flag test.\n");
+    
+    /* read ready flag */
+    res = tea5767_read_ready_flag(&gs_handle, &enable);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read ready flag failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: flag is 0x%02X.\n", enable);
+    
+    /* tea5767_read_band_limit_flag test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_band_limit_flag test.\n");
+    
+    /* read band limit flag */
+    res = tea5767_read_band_limit_flag(&gs_handle, &enable);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read band limit flag failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: flag is 0x%02X.\n", enable);
+    
+    /* tea5767_read_searched_pll test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_searched_pll test.\n");
+    
+    /* read searched pll */
+    res = tea5767_read_searched_pll(&gs_handle, &pll_check);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read searched pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: pll is 0x%04X.\n", pll_check);
+    
+    /* tea5767_read_if test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_if test.\n");
+    
+    /* read if */
+    res = tea5767_read_if(&gs_handle, &output);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read if failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: if is 0x%02X.\n", output);
+    
+    /* tea5767_read_reception test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_reception test.\n");
+    
+    /* read reception */
+    res = tea5767_read_reception(&gs_handle, &reception);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read reception failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: reception is 0x%02X.\n", reception);
+    
+    /* tea5767_read_level_adc_output test */
+    tea5767_interface_debug_print("tea5767: tea5767_read_level_adc_output test.\n");
+    
+    /* read level adc output */
+    res = tea5767_read_level_adc_output(&gs_handle, &output);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read level adc output failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: level adc output is 0x%02X.\n", output);
+    
     /* tea5767_frequency_convert_to_register/tea5767_frequency_convert_to_data test */
     tea5767_interface_debug_print("tea5767: tea5767_frequency_convert_to_register/tea5767_frequency_convert_to_data test.\n");
     
@@ -1251,6 +1535,109 @@ uint8_t tea5767_register_test(void)
     /* output */
     tea5767_interface_debug_print("tea5767: check frequency is %0.1f.\n", mhz_check);
     
+    /* tea5767_khz_to_pll/tea5767_pll_to_khz test */
+    tea5767_interface_debug_print("tea5767: tea5767_khz_to_pll/tea5767_pll_to_khz test.\n");
+    
+    khz = 88000 + (rand() % 20000);
+    
+    /* khz to pll */
+    res = tea5767_khz_to_pll(&gs_handle, khz, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: khz to pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: frequency is %dKHz.\n", khz);
+    
+    /* pll to khz */
+    res = tea5767_pll_to_khz(&gs_handle, pll, &khz_check);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: pll to khz failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* khz to pll */
+    res = tea5767_khz_to_pll(&gs_handle, khz_check, &pll_check);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: khz to pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: check frequency is %dKHz.\n", khz_check);
+    tea5767_interface_debug_print("tea5767: check pll %s.\n", pll == pll_check ? "ok" : "error");
+    if (pll != pll_check)
+    {
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* tea5767_set_channel_index test */
+    tea5767_interface_debug_print("tea5767: tea5767_set_channel_index test.\n");
+    
+    /* set us/europe band */
+    res = tea5767_set_band(&gs_handle, TEA5767_BAND_US_EUROPE);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: set band failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    index = rand() % TEA5767_CHANNEL_US_EUROPE_NUM;
+    
+    /* set channel index */
+    res = tea5767_set_channel_index(&gs_handle, index);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: set channel index failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: set channel index %d.\n", index);
+    
+    /* get pll */
+    res = tea5767_get_pll(&gs_handle, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: get pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* khz to pll */
+    res = tea5767_khz_to_pll(&gs_handle, 87500 + index * TEA5767_CHANNEL_RASTER_KHZ, &pll_check);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: khz to pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    tea5767_interface_debug_print("tea5767: check channel %s.\n", pll == pll_check ? "ok" : "error");
+    if (pll != pll_check)
+    {
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* finish register test */
     tea5767_interface_debug_print("tea5767: finish register test.\n");
     (void)tea5767_deinit(&gs_handle);
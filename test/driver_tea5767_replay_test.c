@@ -0,0 +1,485 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_replay_test.c
+ * @brief     driver tea5767 replay test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_replay_test.h"
+
+static tea5767_handle_t gs_handle;                          /**< tea5767 handle */
+static tea5767_trace_t gs_trace;                            /**< bus trace */
+static tea5767_trace_record_t gs_ring[256];                 /**< trace ring */
+static tea5767_trace_record_t gs_record[256];               /**< captured records */
+static tea5767_trace_replay_t gs_replay;                    /**< replay bus */
+static uint32_t gs_ms;                                      /**< capture time in ms */
+
+/**
+ * @brief  capture clock
+ * @return capture time in us
+ * @note   none
+ */
+static uint32_t a_replay_clock_us(void)
+{
+    return gs_ms * 1000;
+}
+
+/**
+ * @brief     capture delay
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_replay_delay_ms(uint32_t ms)
+{
+    tea5767_interface_delay_ms(ms);
+    gs_ms += ms;
+}
+
+/**
+ * @brief  replay bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_replay_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     replay delay
+ * @param[in] ms time
+ * @note      the replay runs at the captured timestamps and never sleeps
+ */
+static void a_replay_iic_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     print the bus time distribution
+ * @param[in] *record pointer to the captured records
+ * @param[in] num record number
+ * @note      none
+ */
+static void a_replay_print_distribution(const tea5767_trace_record_t *record, uint32_t num)
+{
+    const char *name[3] = {"read", "write", "write read"};
+    uint32_t count[3] = {0};
+    uint32_t bytes[3] = {0};
+    uint32_t fail[3] = {0};
+    uint32_t min[3] = {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL};
+    uint32_t max[3] = {0};
+    uint64_t total[3] = {0};
+    uint32_t bucket[3][16] = {{0}};
+    uint32_t i;
+    uint8_t b;
+    uint8_t d;
+    
+    /* sum all transfers */
+    for (i = 0; i < num; i++)
+    {
+        d = record[i].dir;
+        if (d > TEA5767_TRACE_DIR_WRITE_READ)
+        {
+            continue;
+        }
+        count[d]++;
+        bytes[d] += record[i].wlen + record[i].rlen;
+        fail[d] += (record[i].res != 0) ? 1 : 0;
+        total[d] += record[i].latency_us;
+        min[d] = (record[i].latency_us < min[d]) ? record[i].latency_us : min[d];
+        max[d] = (record[i].latency_us > max[d]) ? record[i].latency_us : max[d];
+        for (b = 0; (b < 15) && ((record[i].latency_us >> (b + 1)) != 0); b++)
+        {
+        }
+        bucket[d][b]++;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: %d transfers in %dms.\n", num, 
+                                  (num != 0) ? (record[num - 1].timestamp_us - record[0].timestamp_us) / 1000 : 0);
+    for (d = 0; d < 3; d++)
+    {
+        if (count[d] == 0)
+        {
+            continue;
+        }
+        tea5767_interface_debug_print("tea5767: %s %d transfers %d bytes %d failed, latency min %dus avg %dus max %dus.\n", 
+                                      name[d], count[d], bytes[d], fail[d], min[d], (uint32_t)(total[d] / count[d]), max[d]);
+        for (b = 0; b < 16; b++)
+        {
+            if (bucket[d][b] != 0)
+            {
+                tea5767_interface_debug_print("tea5767: %s %dus - %dus %d.\n", name[d], 
+                                              (b == 0) ? 0 : (1 << b), (2 << b) - 1, bucket[d][b]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief      replay a search started by a captured write
+ * @param[in]  *conf pointer to the latched conf of the write
+ * @param[in]  base_ms timestamp of the first record in ms
+ * @param[out] *status pointer to a search status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 replay failed
+ * @note       the search is polled at the captured read times, a poll that is not due yet advances the time by 1ms
+ */
+static uint8_t a_replay_search(uint8_t conf[5], uint32_t base_ms, tea5767_search_status_t *status)
+{
+    uint8_t res;
+    uint32_t ms;
+    uint32_t next_ms;
+    
+    /* start the search at the captured time */
+    ms = gs_replay.record[gs_replay.pos].timestamp_us / 1000 - base_ms;
+    res = tea5767_update_conf(&gs_handle, conf);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = tea5767_search_start(&gs_handle, (tea5767_search_mode_t)((conf[2] >> 7) & 0x01), ms);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* poll until the search finishes or the trace ends */
+    *status = TEA5767_SEARCH_STATUS_BUSY;
+    while ((*status == TEA5767_SEARCH_STATUS_BUSY) && (gs_replay.pos < gs_replay.num))
+    {
+        next_ms = gs_replay.record[gs_replay.pos].timestamp_us / 1000 - base_ms;
+        ms = ((int32_t)(next_ms - ms) > 0) ? next_ms : ms + 1;
+        res = tea5767_search_poll(&gs_handle, ms, status);
+        if (res != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      feed the records back through the driver
+ * @param[in]  *record pointer to the captured records
+ * @param[in]  num record number
+ * @param[out] *searched pointer to a searched pll buffer
+ * @param[out] *status pointer to a search status buffer of the last search
+ * @return     status code
+ *             - 0 success
+ *             - 1 replay failed
+ * @note       none
+ */
+static uint8_t a_replay_run(const tea5767_trace_record_t *record, uint32_t num, uint16_t *searched, tea5767_search_status_t *status)
+{
+    uint8_t res;
+    uint8_t wnum;
+    uint8_t i;
+    uint8_t buf[256];
+    uint8_t conf[5];
+    uint32_t pos;
+    
+    /* link the replay bus */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, a_replay_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, a_replay_iic_init);
+    DRIVER_TEA5767_LINK_IIC_READ_CTX_COMMAND(&gs_handle, tea5767_trace_replay_read);
+    DRIVER_TEA5767_LINK_IIC_WRITE_CTX_COMMAND(&gs_handle, tea5767_trace_replay_write);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_CTX_COMMAND(&gs_handle, tea5767_trace_replay_write_read);
+    DRIVER_TEA5767_LINK_BUS_CTX(&gs_handle, &gs_replay);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, a_replay_iic_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    if (tea5767_trace_replay_init(&gs_replay, record, num) != 0)
+    {
+        return 1;
+    }
+    if (tea5767_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* replay all records */
+    *searched = 0;
+    *status = TEA5767_SEARCH_STATUS_IDLE;
+    while (gs_replay.pos < num)
+    {
+        pos = gs_replay.pos;
+        wnum = (record[pos].wlen > TEA5767_TRACE_DATA_SIZE) ? TEA5767_TRACE_DATA_SIZE : record[pos].wlen;
+        memcpy(conf, gs_replay.expect, 5);
+        for (i = 0; (i < wnum) && (i < 5); i++)
+        {
+            conf[i] = record[pos].data[i];
+        }
+        if (record[pos].dir == TEA5767_TRACE_DIR_READ)
+        {
+            /* read the captured length */
+            res = tea5767_get_reg(&gs_handle, buf, record[pos].rlen);
+        }
+        else if (record[pos].dir == TEA5767_TRACE_DIR_WRITE_READ)
+        {
+            /* write and read the conf */
+            res = tea5767_update_conf(&gs_handle, conf);
+            if (res == 0)
+            {
+                res = tea5767_write_read_conf(&gs_handle);
+            }
+        }
+        else if ((wnum != 0) && (((conf[0] >> 6) & 0x01) != 0))
+        {
+            /* the search bit starts a search */
+            res = a_replay_search(conf, record[0].timestamp_us / 1000, status);
+            *searched = ((uint16_t)(gs_handle.conf_up[0] & 0x3F) << 8) | gs_handle.conf_up[1];
+            tea5767_interface_debug_print("tea5767: replayed search %s pll 0x%04X at record %d.\n", 
+                                          (*status == TEA5767_SEARCH_STATUS_FOUND) ? "found" : 
+                                          (*status == TEA5767_SEARCH_STATUS_BAND_LIMIT) ? "reached the band limit" : 
+                                          (*status == TEA5767_SEARCH_STATUS_TIMEOUT) ? "timed out" : "did not finish", 
+                                          *searched, pos);
+        }
+        else
+        {
+            /* write the captured bytes */
+            res = tea5767_set_reg(&gs_handle, (uint8_t *)record[pos].data, wnum);
+        }
+        
+        /* a failed transfer is replayed, a stalled replay is not */
+        if ((res != 0) && (gs_replay.pos == pos))
+        {
+            tea5767_interface_debug_print("tea5767: replay diverged at record %d.\n", pos);
+            
+            return 1;
+        }
+    }
+    
+    /* the captured power down is replayed, so the handle is not closed */
+    return 0;
+}
+
+/**
+ * @brief     replay a captured trace
+ * @param[in] *record pointer to the captured records
+ * @param[in] num record number
+ * @return    status code
+ *            - 0 success
+ *            - 1 replay failed
+ * @note      the bus time distribution is printed and the trace is fed back through the driver
+ */
+uint8_t tea5767_replay_trace(const tea5767_trace_record_t *record, uint32_t num)
+{
+    uint16_t searched;
+    tea5767_search_status_t status;
+    
+    /* print the distribution */
+    a_replay_print_distribution(record, num);
+    
+    /* replay */
+    if (a_replay_run(record, num, &searched, &status) != 0)
+    {
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: replayed %d transfers with %d mismatches.\n", gs_replay.pos, gs_replay.mismatch);
+    
+    return (gs_replay.mismatch != 0) ? 1 : 0;
+}
+
+/**
+ * @brief  replay test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a search is captured on the linked bus and replayed through the trace replay bus,
+ *         the test is skipped when TEA5767_TRACE is 0
+ */
+uint8_t tea5767_replay_test(void)
+{
+    uint8_t res;
+    uint16_t pll;
+    uint16_t searched;
+    uint32_t i;
+    tea5767_trace_header_t header;
+    tea5767_search_status_t status;
+    tea5767_search_status_t replayed;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, a_replay_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    DRIVER_TEA5767_LINK_TRACE(&gs_handle, &gs_trace);
+    
+    /* start replay test */
+    tea5767_interface_debug_print("tea5767: start replay test.\n");
+    
+#if (TEA5767_TRACE == 0)
+    /* the capture needs the trace hook */
+    tea5767_interface_debug_print("tea5767: trace hook is compiled out by TEA5767_TRACE, skip replay test.\n");
+    
+    return 0;
+#endif
+    
+    /* trace init */
+    gs_ms = 0;
+    res = tea5767_trace_init(&gs_trace, gs_ring, 256, a_replay_clock_us);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: trace init failed.\n");
+        
+        return 1;
+    }
+    
+    /* tea5767 init */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* capture a tune */
+    tea5767_interface_debug_print("tea5767: capture a tune and a search.\n");
+    (void)tea5767_set_mute(&gs_handle, TEA5767_BOOL_FALSE);
+    (void)tea5767_set_band(&gs_handle, TEA5767_BAND_US_EUROPE);
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_search_stop_level(&gs_handle, TEA5767_SEARCH_STOP_LEVEL_MID);
+    (void)tea5767_set_pll(&gs_handle, 0x2A00);
+    res = tea5767_write_read_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: write read conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_replay_delay_ms(100);
+    res = tea5767_read_status(&gs_handle, 4);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read status failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* capture a search */
+    res = tea5767_search_start(&gs_handle, TEA5767_SEARCH_MODE_UP, gs_ms);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: search start failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    status = TEA5767_SEARCH_STATUS_BUSY;
+    while (status == TEA5767_SEARCH_STATUS_BUSY)
+    {
+        res = tea5767_search_poll(&gs_handle, gs_ms, &status);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: search poll failed.\n");
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        a_replay_delay_ms(1);
+    }
+    pll = ((uint16_t)(gs_handle.conf_up[0] & 0x3F) << 8) | gs_handle.conf_up[1];
+    res = tea5767_read_status(&gs_handle, 5);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read status failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)tea5767_deinit(&gs_handle);
+    
+    /* copy the captured records */
+    (void)tea5767_trace_get_header(&gs_trace, &header);
+    for (i = 0; i < header.num; i++)
+    {
+        (void)tea5767_trace_get_record(&gs_trace, i, &gs_record[i]);
+    }
+    tea5767_interface_debug_print("tea5767: captured %d transfers, search pll 0x%04X.\n", header.num, pll);
+    
+    /* replay the capture */
+    tea5767_interface_debug_print("tea5767: replay the capture.\n");
+    a_replay_print_distribution(gs_record, header.num);
+    res = a_replay_run(gs_record, header.num, &searched, &replayed);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: replay failed.\n");
+        
+        return 1;
+    }
+    if ((gs_replay.mismatch != 0) || (gs_replay.pos != header.num) || (replayed != status) || (searched != pll))
+    {
+        tea5767_interface_debug_print("tea5767: replay differs, %d mismatches.\n", gs_replay.mismatch);
+        
+        return 1;
+    }
+    tea5767_interface_debug_print("tea5767: replayed %d transfers with %d mismatches.\n", gs_replay.pos, gs_replay.mismatch);
+    
+    /* clear the ready flag of the last search poll */
+    tea5767_interface_debug_print("tea5767: replay a trace with a late ready flag.\n");
+    for (i = header.num; i > 0; i--)
+    {
+        if ((gs_record[i - 1].dir == TEA5767_TRACE_DIR_READ) && (gs_record[i - 1].rlen == 2))
+        {
+            gs_record[i - 1].data[0] &= ~(1 << 7);
+            
+            break;
+        }
+    }
+    res = a_replay_run(gs_record, header.num, &searched, &replayed);
+    if ((res != 0) || ((gs_replay.mismatch == 0) && (replayed == status)))
+    {
+        tea5767_interface_debug_print("tea5767: changed trace is not detected.\n");
+        
+        return 1;
+    }
+    tea5767_interface_debug_print("tea5767: replayed %d transfers with %d mismatches.\n", gs_replay.pos, gs_replay.mismatch);
+    
+    /* finish replay test */
+    tea5767_interface_debug_print("tea5767: finish replay test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_replay_test.h
+ * @brief     driver tea5767 replay test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_REPLAY_TEST_H
+#define DRIVER_TEA5767_REPLAY_TEST_H
+
+#include "driver_tea5767_interface.h"
+#include "driver_tea5767_trace.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup tea5767_test_driver
+ * @{
+ */
+
+/**
+ * @brief  replay test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a search is captured on the linked bus and replayed through the trace replay bus,
+ *         the test is skipped when TEA5767_TRACE is 0
+ */
+uint8_t tea5767_replay_test(void);
+
+/**
+ * @brief     replay a captured trace
+ * @param[in] *record pointer to the captured records
+ * @param[in] num record number
+ * @return    status code
+ *            - 0 success
+ *            - 1 replay failed
+ * @note      the bus time distribution is printed and the trace is fed back through the driver
+ */
+uint8_t tea5767_replay_trace(const tea5767_trace_record_t *record, uint32_t num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_sched_test.c
+ * @brief     driver tea5767 sched test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_sched_test.h"
+
+static tea5767_handle_t gs_handle;              /**< tea5767 handle */
+static tea5767_sched_t gs_sched;                /**< task scheduler */
+static tea5767_task_t gs_seek_task;             /**< seek task */
+static tea5767_task_t gs_search_task;           /**< search task of the seek */
+static tea5767_task_t gs_afc_task;              /**< afc task of the seek */
+static tea5767_task_t gs_tick_task;             /**< tick task */
+
+/**
+ * @brief     seek step function
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] ms current timestamp in ms
+ * @return    tea5767_task_status_t
+ * @note      searches up and locks the if counter of the found station
+ */
+static uint8_t a_sched_seek_step(tea5767_task_t *task, uint32_t ms)
+{
+    TEA5767_TASK_BEGIN(task);
+    if (tea5767_search_task(&gs_handle, &gs_search_task, TEA5767_SEARCH_MODE_UP) != 0)
+    {
+        TEA5767_TASK_EXIT(task, 1);
+    }
+    TEA5767_TASK_AWAIT(task, &gs_search_task, ms);
+    if (gs_search_task.res != 0)
+    {
+        TEA5767_TASK_EXIT(task, gs_search_task.res);
+    }
+    if (tea5767_afc_task(&gs_handle, &gs_afc_task) != 0)
+    {
+        TEA5767_TASK_EXIT(task, 1);
+    }
+    TEA5767_TASK_AWAIT(task, &gs_afc_task, ms);
+    task->if_out = gs_afc_task.if_out;
+    TEA5767_TASK_EXIT(task, gs_afc_task.res);
+    TEA5767_TASK_END(task);
+}
+
+/**
+ * @brief     tick step function
+ * @param[in] *task pointer to a tea5767 task structure
+ * @param[in] ms current timestamp in ms
+ * @return    tea5767_task_status_t
+ * @note      stands for another peripheral that runs every 20ms
+ */
+static uint8_t a_sched_tick_step(tea5767_task_t *task, uint32_t ms)
+{
+    TEA5767_TASK_BEGIN(task);
+    for (task->num = 0; task->num < 10; task->num++)
+    {
+        TEA5767_TASK_SLEEP(task, ms, 20);
+    }
+    TEA5767_TASK_END(task);
+}
+
+/**
+ * @brief  sched test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a seek with afc runs on the scheduler next to a 20ms tick task,
+ *         both must finish and the seek must end inside the if window
+ */
+uint8_t tea5767_sched_test(void)
+{
+    uint8_t res;
+    uint16_t pll;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    
+    /* start sched test */
+    tea5767_interface_debug_print("tea5767: start sched test.\n");
+    
+    /* tea5767 init */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* start from the band bottom */
+    (void)tea5767_set_mute(&gs_handle, TEA5767_BOOL_FALSE);
+    (void)tea5767_set_band(&gs_handle, TEA5767_BAND_US_EUROPE);
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_side_injection(&gs_handle, TEA5767_SIDE_INJECTION_LOW);
+    (void)tea5767_set_search_stop_level(&gs_handle, TEA5767_SEARCH_STOP_LEVEL_MID);
+    (void)tea5767_set_pll(&gs_handle, 0x2A00);
+    res = tea5767_write_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: write conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* seek next to another task */
+    tea5767_interface_debug_print("tea5767: seek on the task scheduler.\n");
+    (void)tea5767_sched_init(&gs_sched);
+    (void)tea5767_task_init(&gs_seek_task, a_sched_seek_step, NULL);
+    (void)tea5767_task_init(&gs_tick_task, a_sched_tick_step, NULL);
+    (void)tea5767_sched_add(&gs_sched, &gs_seek_task);
+    (void)tea5767_sched_add(&gs_sched, &gs_tick_task);
+    res = tea5767_sched_run(&gs_sched, tea5767_interface_delay_ms);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: sched run failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* get pll */
+    res = tea5767_get_pll(&gs_handle, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: get pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    tea5767_interface_debug_print("tea5767: seek result %d pll 0x%04X if 0x%02X, tick ran %d times.\n", 
+                                  gs_seek_task.res, pll, gs_seek_task.if_out, gs_tick_task.num);
+    
+    /* check both tasks */
+    if ((gs_seek_task.status != TEA5767_TASK_STATUS_DONE) || (gs_seek_task.if_out < 0x31) || (gs_seek_task.if_out > 0x3E) || 
+        (gs_tick_task.status != TEA5767_TASK_STATUS_DONE) || (gs_tick_task.num != 10))
+    {
+        tea5767_interface_debug_print("tea5767: seek task failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish sched test */
+    tea5767_interface_debug_print("tea5767: finish sched test.\n");
+    (void)tea5767_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,743 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_simulator.c
+ * @brief     driver tea5767 simulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_simulator.h"
+
+/**
+ * @brief band limit definition
+ */
+#define SIMULATOR_US_EUROPE_MIN_HZ        87500000UL        /**< US/Europe band min */
+#define SIMULATOR_US_EUROPE_MAX_HZ        108000000UL       /**< US/Europe band max */
+#define SIMULATOR_JAPANESE_MIN_HZ         76000000UL        /**< Japanese band min */
+#define SIMULATOR_JAPANESE_MAX_HZ         91000000UL        /**< Japanese band max */
+#define SIMULATOR_IF_HZ                   225000UL          /**< intermediate frequency */
+#define SIMULATOR_SEARCH_STEP_HZ          100000UL          /**< search step */
+#define SIMULATOR_IF_WINDOW_HZ            100000UL          /**< if counter capture range */
+
+/**
+ * @brief default synthetic band definition
+ */
+static const tea5767_simulator_station_t gsc_default_station[] =
+{
+    {76500,  9, 0}, {78000, 11, 1}, {80400,  7, 0}, {82050, 10, 0},
+    {82500, 12, 1}, {84700,  8, 0}, {87600, 10, 0}, {88700,  9, 0},
+    {89700, 13, 1}, {90500,  6, 0}, {92400, 11, 1}, {94600, 12, 0},
+    {96800,  8, 0}, {98100, 14, 1}, {100300, 9, 0}, {101700, 7, 0},
+    {103900, 12, 1}, {105500, 10, 0}, {107200, 8, 0},
+};
+
+static tea5767_simulator_t gs_sim;             /**< default simulator */
+static uint8_t gs_sim_inited = 0;              /**< default simulator inited flag */
+
+/**
+ * @brief     get the pll reference frequency
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    reference frequency in Hz
+ * @note      13MHz and 6.5MHz crystals are divided down to 50KHz
+ */
+static uint32_t a_simulator_ref_hz(tea5767_simulator_t *sim)
+{
+    if (((sim->reg[3] >> 4) & 0x01) != 0)        /* xtal 32.768KHz */
+    {
+        return 32768;                            /* 32.768KHz */
+    }
+    else
+    {
+        return 50000;                            /* 13MHz / 260 or 6.5MHz / 130 */
+    }
+}
+
+/**
+ * @brief     convert the pll to the tuned radio frequency
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] pll pll word
+ * @return    radio frequency in Hz
+ * @note      none
+ */
+static int64_t a_simulator_pll_to_hz(tea5767_simulator_t *sim, uint16_t pll)
+{
+    int64_t lo;
+    
+    lo = ((int64_t)pll * a_simulator_ref_hz(sim)) / 4;        /* local oscillator */
+    if (((sim->reg[2] >> 4) & 0x01) != 0)                     /* high side injection */
+    {
+        return lo - SIMULATOR_IF_HZ;                          /* lo above rf */
+    }
+    else
+    {
+        return lo + SIMULATOR_IF_HZ;                          /* lo below rf */
+    }
+}
+
+/**
+ * @brief     convert the radio frequency to the pll
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] hz radio frequency in Hz
+ * @return    pll word
+ * @note      none
+ */
+static uint16_t a_simulator_hz_to_pll(tea5767_simulator_t *sim, int64_t hz)
+{
+    int64_t lo;
+    int64_t pll;
+    
+    if (((sim->reg[2] >> 4) & 0x01) != 0)                     /* high side injection */
+    {
+        lo = hz + SIMULATOR_IF_HZ;                            /* lo above rf */
+    }
+    else
+    {
+        lo = hz - SIMULATOR_IF_HZ;                            /* lo below rf */
+    }
+    pll = (lo * 4) / a_simulator_ref_hz(sim);                 /* divide */
+    if (pll < 0)                                              /* check min */
+    {
+        pll = 0;                                              /* clamp */
+    }
+    if (pll > 0x3FFF)                                         /* check max */
+    {
+        pll = 0x3FFF;                                         /* clamp */
+    }
+    
+    return (uint16_t)pll;                                     /* return the pll */
+}
+
+/**
+ * @brief     get the raw level of a radio frequency
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] hz radio frequency in Hz
+ * @return    level adc output without image interference
+ * @note      none
+ */
+static uint8_t a_simulator_raw_level(tea5767_simulator_t *sim, int64_t hz)
+{
+    uint8_t i;
+    uint8_t level;
+    int64_t diff;
+    int64_t l;
+    
+    level = sim->noise_level;                                                  /* noise floor */
+    for (i = 0; i < sim->station_num; i++)                                     /* check all stations */
+    {
+        diff = hz - (int64_t)sim->station[i].khz * 1000;                       /* detuning */
+        if (diff < 0)                                                          /* abs */
+        {
+            diff = -diff;                                                      /* positive */
+        }
+        l = (int64_t)sim->station[i].level -
+            diff / TEA5767_SIMULATOR_LEVEL_ROLLOFF_HZ;                         /* rolloff */
+        if (l > level)                                                         /* keep the strongest */
+        {
+            level = (uint8_t)l;                                                /* save level */
+        }
+    }
+    
+    return level;                                                              /* return level */
+}
+
+/**
+ * @brief     get the level adc output of a radio frequency
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] hz radio frequency in Hz
+ * @return    level adc output
+ * @note      a station on the image frequency is mixed into the if and raises the level
+ */
+static uint8_t a_simulator_level(tea5767_simulator_t *sim, int64_t hz)
+{
+    int64_t image;
+    int32_t level;
+    int32_t interference;
+    
+    if (((sim->reg[2] >> 4) & 0x01) != 0)                                      /* high side injection */
+    {
+        image = hz + 2 * SIMULATOR_IF_HZ;                                      /* image above lo */
+    }
+    else
+    {
+        image = hz - 2 * SIMULATOR_IF_HZ;                                      /* image below lo */
+    }
+    level = a_simulator_raw_level(sim, hz);                                    /* wanted level */
+    interference = (int32_t)a_simulator_raw_level(sim, image) -
+                   (int32_t)sim->noise_level;                                  /* image level */
+    if (interference > 0)                                                      /* check image */
+    {
+        level += interference / 2;                                             /* add the image energy */
+    }
+    if (level > 15)                                                            /* check max */
+    {
+        level = 15;                                                            /* clamp */
+    }
+    
+    return (uint8_t)level;                                                     /* return level */
+}
+
+/**
+ * @brief      get the status of the settled pll
+ * @param[in]  *sim pointer to a tea5767 simulator structure
+ * @param[out] *out pointer to a 4 bytes status buffer
+ * @note       none
+ */
+static void a_simulator_status(tea5767_simulator_t *sim, uint8_t *out)
+{
+    uint8_t i;
+    uint8_t stereo;
+    uint8_t if_count;
+    uint8_t level;
+    int64_t hz;
+    int64_t diff;
+    int64_t best;
+    int64_t if_hz;
+    
+    hz = a_simulator_pll_to_hz(sim, sim->pll);                             /* tuned frequency */
+    level = a_simulator_level(sim, hz);                                    /* level */
+    if_count = 0x10;                                                       /* no carrier */
+    stereo = 0;                                                            /* mono */
+    best = (int64_t)SIMULATOR_IF_WINDOW_HZ;                                /* capture range */
+    for (i = 0; i < sim->station_num; i++)                                 /* find the nearest station */
+    {
+        diff = hz - (int64_t)sim->station[i].khz * 1000;                   /* tuned above station */
+        if (((diff < 0) ? -diff : diff) < ((best < 0) ? -best : best))     /* nearer */
+        {
+            best = diff;                                                   /* save */
+            stereo = sim->station[i].stereo;                               /* save stereo */
+        }
+    }
+    if (best != (int64_t)SIMULATOR_IF_WINDOW_HZ)                           /* carrier captured */
+    {
+        if (((sim->reg[2] >> 4) & 0x01) != 0)                              /* high side injection */
+        {
+            if_hz = best;                                                  /* if = lo - station */
+        }
+        else
+        {
+            if_hz = -best;                                                 /* if = station - lo */
+        }
+        if_hz = TEA5767_SIMULATOR_IF_NOMINAL * TEA5767_SIMULATOR_IF_STEP_HZ + if_hz;
+        if_count = (uint8_t)((if_hz / TEA5767_SIMULATOR_IF_STEP_HZ) & 0x7F);       /* counter */
+    }
+    if ((((sim->reg[2] >> 3) & 0x01) != 0) || (level < 7))                 /* forced mono or weak */
+    {
+        stereo = 0;                                                        /* mono */
+    }
+    out[0] = (uint8_t)((1 << 7) | (sim->blf << 6) | ((sim->pll >> 8) & 0x3F));     /* rf, blf and pll high */
+    out[1] = sim->pll & 0xFF;                                              /* pll low */
+    out[2] = (uint8_t)((stereo << 7) | if_count);                          /* stereo and if */
+    out[3] = (uint8_t)(level << 4);                                        /* level, chip id 0 */
+}
+
+/**
+ * @brief     get the bus time of a transfer
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] len data length
+ * @return    bus time in us
+ * @note      address byte, data bytes, ack bits, start and stop
+ */
+static uint32_t a_simulator_bus_us(tea5767_simulator_t *sim, uint16_t len)
+{
+    uint32_t bits;
+    
+    bits = (1 + (uint32_t)len) * 9 + 2;                                        /* bits on the bus */
+    
+    return (uint32_t)(((uint64_t)bits * 1000000UL + sim->iic_hz - 1) / sim->iic_hz);        /* round up */
+}
+
+/**
+ * @brief     start a search from the latched pll
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @note      none
+ */
+static void a_simulator_search(tea5767_simulator_t *sim)
+{
+    int64_t hz;
+    int64_t min_hz;
+    int64_t max_hz;
+    uint32_t steps;
+    uint8_t stop;
+    uint8_t ssl;
+    uint8_t up;
+    
+    if (((sim->reg[3] >> 5) & 0x01) != 0)                                      /* Japanese band */
+    {
+        min_hz = SIMULATOR_JAPANESE_MIN_HZ;                                    /* set min */
+        max_hz = SIMULATOR_JAPANESE_MAX_HZ;                                    /* set max */
+    }
+    else
+    {
+        min_hz = SIMULATOR_US_EUROPE_MIN_HZ;                                   /* set min */
+        max_hz = SIMULATOR_US_EUROPE_MAX_HZ;                                   /* set max */
+    }
+    ssl = (sim->reg[2] >> 5) & 0x03;                                           /* search stop level */
+    if (ssl == 3)                                                              /* high */
+    {
+        stop = 10;                                                             /* level 10 */
+    }
+    else if (ssl == 2)                                                         /* mid */
+    {
+        stop = 7;                                                              /* level 7 */
+    }
+    else                                                                       /* low */
+    {
+        stop = 5;                                                              /* level 5 */
+    }
+    up = (sim->reg[2] >> 7) & 0x01;                                            /* search direction */
+    hz = a_simulator_pll_to_hz(sim, (uint16_t)(((uint16_t)(sim->reg[0] & 0x3F) << 8) | sim->reg[1]));
+    steps = 0;                                                                 /* init 0 */
+    sim->blf = 0;                                                              /* clear band limit */
+    while (1)
+    {
+        hz += (up != 0) ? (int64_t)SIMULATOR_SEARCH_STEP_HZ : -(int64_t)SIMULATOR_SEARCH_STEP_HZ;
+        steps++;                                                               /* next step */
+        if (hz > max_hz)                                                       /* reach max */
+        {
+            hz = max_hz;                                                       /* stop at limit */
+            sim->blf = 1;                                                      /* set band limit */
+            
+            break;                                                             /* break */
+        }
+        if (hz < min_hz)                                                       /* reach min */
+        {
+            hz = min_hz;                                                       /* stop at limit */
+            sim->blf = 1;                                                      /* set band limit */
+            
+            break;                                                             /* break */
+        }
+        if (a_simulator_level(sim, hz) >= stop)                                /* station found */
+        {
+            break;                                                             /* break */
+        }
+    }
+    sim->pll = a_simulator_hz_to_pll(sim, hz);                                 /* save the searched pll */
+    sim->ready_us = sim->stats.time_us + (uint64_t)steps * sim->search_step_us
+                    + sim->tune_us;                                            /* set the ready time */
+    sim->stats.search_count++;                                                 /* count searches */
+}
+
+/**
+ * @brief     initialize the simulator with the default band
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      none
+ */
+uint8_t tea5767_simulator_init(tea5767_simulator_t *sim)
+{
+    uint8_t i;
+    
+    if (sim == NULL)                                                           /* check sim */
+    {
+        return 2;                                                              /* return error */
+    }
+    
+    memset(sim, 0, sizeof(tea5767_simulator_t));                               /* clear the simulator */
+    sim->addr = TEA5767_SIMULATOR_DEFAULT_ADDRESS;                             /* set address */
+    sim->iic_hz = TEA5767_SIMULATOR_DEFAULT_IIC_HZ;                            /* set iic clock */
+    sim->tune_us = TEA5767_SIMULATOR_DEFAULT_TUNE_US;                          /* set tuning time */
+    sim->search_step_us = TEA5767_SIMULATOR_DEFAULT_SEARCH_STEP_US;            /* set search step time */
+    sim->noise_level = TEA5767_SIMULATOR_DEFAULT_NOISE_LEVEL;                  /* set noise level */
+    sim->reg[3] = 1 << 6;                                                      /* power on in standby */
+    for (i = 0; i < sizeof(gsc_default_station) / sizeof(gsc_default_station[0]); i++)
+    {
+        sim->station[i] = gsc_default_station[i];                              /* copy the station */
+    }
+    sim->station_num = i;                                                      /* set the station number */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     remove all stations
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      none
+ */
+uint8_t tea5767_simulator_clear_station(tea5767_simulator_t *sim)
+{
+    if (sim == NULL)                  /* check sim */
+    {
+        return 2;                     /* return error */
+    }
+    
+    sim->station_num = 0;             /* clear all */
+    
+    return 0;                         /* success return 0 */
+}
+
+/**
+ * @brief     add a station
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] khz station frequency in KHz
+ * @param[in] level peak level adc output
+ * @param[in] stereo stereo pilot flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 station table is full
+ *            - 2 sim is NULL
+ *            - 4 level > 15
+ * @note      none
+ */
+uint8_t tea5767_simulator_add_station(tea5767_simulator_t *sim, uint32_t khz, uint8_t level, uint8_t stereo)
+{
+    if (sim == NULL)                                                 /* check sim */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (sim->station_num >= TEA5767_SIMULATOR_MAX_STATION)           /* check the table */
+    {
+        return 1;                                                    /* return error */
+    }
+    if (level > 15)                                                  /* check the level */
+    {
+        return 4;                                                    /* return error */
+    }
+    
+    sim->station[sim->station_num].khz = khz;                        /* set frequency */
+    sim->station[sim->station_num].level = level;                    /* set level */
+    sim->station[sim->station_num].stereo = (stereo != 0);           /* set stereo */
+    sim->station_num++;                                              /* station number++ */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     set the timing model
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] iic_hz iic bus clock in Hz
+ * @param[in] tune_us preset tuning time in us
+ * @param[in] search_step_us search time per 100KHz step in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 iic_hz is 0
+ * @note      none
+ */
+uint8_t tea5767_simulator_set_timing(tea5767_simulator_t *sim, uint32_t iic_hz, uint32_t tune_us, uint32_t search_step_us)
+{
+    if (sim == NULL)                              /* check sim */
+    {
+        return 2;                                 /* return error */
+    }
+    if (iic_hz == 0)                              /* check iic clock */
+    {
+        return 4;                                 /* return error */
+    }
+    
+    sim->iic_hz = iic_hz;                         /* set iic clock */
+    sim->tune_us = tune_us;                       /* set tuning time */
+    sim->search_step_us = search_step_us;         /* set search step time */
+    
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief     simulate an iic write transfer
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 no acknowledge
+ * @note      bytes are latched in order, so a short write keeps the tail registers,
+ *            the if counter and the level adc keep the last settled reading while a new pll settles
+ */
+uint8_t tea5767_simulator_write(tea5767_simulator_t *sim, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint16_t pll;
+    uint8_t standby;
+    uint8_t out[4];
+    
+    if ((sim == NULL) || (addr != sim->addr))                                  /* check address */
+    {
+        return 1;                                                              /* no ack */
+    }
+    
+    sim->stats.time_us += a_simulator_bus_us(sim, len);                        /* bus time */
+    sim->stats.bus_us += a_simulator_bus_us(sim, len);                         /* bus time */
+    sim->stats.write_count++;                                                  /* count transfers */
+    sim->stats.write_bytes += len;                                             /* count bytes */
+    if (len == 0)                                                              /* address only */
+    {
+        return 0;                                                              /* success return 0 */
+    }
+    
+    standby = (sim->reg[3] >> 6) & 0x01;                                       /* save the standby */
+    if ((standby == 0) && (sim->stats.time_us >= sim->ready_us))               /* settled */
+    {
+        a_simulator_status(sim, out);                                          /* sample the status */
+        sim->hold[0] = out[2];                                                 /* hold the if */
+        sim->hold[1] = out[3];                                                 /* hold the level */
+    }
+    for (i = 0; (i < len) && (i < 5); i++)                                     /* latch in order */
+    {
+        sim->reg[i] = buf[i];                                                  /* latch byte */
+    }
+    if (((sim->reg[3] >> 6) & 0x01) != 0)                                      /* standby */
+    {
+        return 0;                                                              /* success return 0 */
+    }
+    
+    pll = (uint16_t)(((uint16_t)(sim->reg[0] & 0x3F) << 8) | sim->reg[1]);    /* latched pll */
+    if (((sim->reg[0] >> 6) & 0x01) != 0)                                      /* search mode */
+    {
+        a_simulator_search(sim);                                               /* start search */
+    }
+    else if ((pll != sim->pll) || (standby != 0))                              /* preset tune */
+    {
+        sim->pll = pll;                                                        /* set pll */
+        sim->blf = 0;                                                          /* clear band limit */
+        sim->ready_us = sim->stats.time_us + sim->tune_us;                     /* set the ready time */
+        sim->stats.tune_count++;                                               /* count tunes */
+    }
+    else
+    {
+        /* settings only */
+    }
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      simulate an iic read transfer
+ * @param[in]  *sim pointer to a tea5767 simulator structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no acknowledge
+ * @note       none
+ */
+uint8_t tea5767_simulator_read(tea5767_simulator_t *sim, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t out[5];
+    uint8_t i;
+    uint8_t ready;
+    
+    if ((sim == NULL) || (addr != sim->addr))                                  /* check address */
+    {
+        return 1;                                                              /* no ack */
+    }
+    
+    sim->stats.time_us += a_simulator_bus_us(sim, len);                        /* bus time */
+    sim->stats.bus_us += a_simulator_bus_us(sim, len);                         /* bus time */
+    sim->stats.read_count++;                                                   /* count transfers */
+    sim->stats.read_bytes += len;                                              /* count bytes */
+    
+    memset(out, 0, sizeof(out));                                               /* clear the output */
+    ready = (uint8_t)(sim->stats.time_us >= sim->ready_us);                    /* check settled */
+    if (((sim->reg[3] >> 6) & 0x01) != 0)                                      /* standby */
+    {
+        out[0] = (sim->pll >> 8) & 0x3F;                                       /* pll high */
+        out[1] = sim->pll & 0xFF;                                              /* pll low */
+    }
+    else if (ready == 0)                                                       /* settling */
+    {
+        sim->stats.not_ready_count++;                                          /* count polls */
+        out[0] = (sim->pll >> 8) & 0x3F;                                       /* pll high */
+        out[1] = sim->pll & 0xFF;                                              /* pll low */
+        out[2] = sim->hold[0];                                                 /* if of the last settled pll */
+        out[3] = sim->hold[1];                                                 /* level of the last settled pll */
+    }
+    else
+    {
+        a_simulator_status(sim, out);                                          /* settled status */
+    }
+    for (i = 0; (i < len) && (i < 5); i++)                                     /* copy the prefix */
+    {
+        buf[i] = out[i];                                                       /* copy */
+    }
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     advance the virtual time
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] us elapsed time in us
+ * @note      none
+ */
+void tea5767_simulator_advance_us(tea5767_simulator_t *sim, uint32_t us)
+{
+    if (sim != NULL)                       /* check sim */
+    {
+        sim->stats.time_us += us;          /* advance */
+    }
+}
+
+/**
+ * @brief     get the virtual time
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    virtual time in us
+ * @note      none
+ */
+uint64_t tea5767_simulator_get_time_us(tea5767_simulator_t *sim)
+{
+    if (sim == NULL)                       /* check sim */
+    {
+        return 0;                          /* return 0 */
+    }
+    
+    return sim->stats.time_us;             /* return the time */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *sim pointer to a tea5767 simulator structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim is NULL
+ * @note       none
+ */
+uint8_t tea5767_simulator_get_stats(tea5767_simulator_t *sim, tea5767_simulator_stats_t *stats)
+{
+    if (sim == NULL)                                                   /* check sim */
+    {
+        return 2;                                                      /* return error */
+    }
+    
+    memcpy(stats, &sim->stats, sizeof(tea5767_simulator_stats_t));     /* copy the stats */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     reset the statistics
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the virtual time keeps running
+ */
+uint8_t tea5767_simulator_reset_stats(tea5767_simulator_t *sim)
+{
+    uint64_t time_us;
+    
+    if (sim == NULL)                                                   /* check sim */
+    {
+        return 2;                                                      /* return error */
+    }
+    
+    time_us = sim->stats.time_us;                                      /* save the time */
+    memset(&sim->stats, 0, sizeof(tea5767_simulator_stats_t));         /* clear the stats */
+    sim->stats.time_us = time_us;                                      /* restore the time */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief  get the default simulator instance
+ * @return pointer to the default simulator
+ * @note   the default instance is initialized on the first call
+ */
+tea5767_simulator_t *tea5767_simulator_get_default(void)
+{
+    if (gs_sim_inited == 0)                        /* check inited */
+    {
+        (void)tea5767_simulator_init(&gs_sim);     /* init the default */
+        gs_sim_inited = 1;                         /* flag inited */
+    }
+    
+    return &gs_sim;                                /* return the default */
+}
+
+/**
+ * @brief  simulator iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t tea5767_simulator_iic_init(void)
+{
+    (void)tea5767_simulator_get_default();        /* make sure inited */
+    
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief  simulator iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t tea5767_simulator_iic_deinit(void)
+{
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief     simulator iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      uses the default simulator
+ */
+uint8_t tea5767_simulator_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return tea5767_simulator_write(tea5767_simulator_get_default(), addr, buf, len);
+}
+
+/**
+ * @brief      simulator iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       uses the default simulator
+ */
+uint8_t tea5767_simulator_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return tea5767_simulator_read(tea5767_simulator_get_default(), addr, buf, len);
+}
+
+/**
+ * @brief     simulator delay ms
+ * @param[in] ms time
+ * @note      advances the virtual time of the default simulator
+ */
+void tea5767_simulator_delay_ms(uint32_t ms)
+{
+    tea5767_simulator_advance_us(tea5767_simulator_get_default(), ms * 1000);
+}
@@ -0,0 +1,287 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_simulator.h
+ * @brief     driver tea5767 simulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_TEA5767_SIMULATOR_H
+#define DRIVER_TEA5767_SIMULATOR_H
+
+#include "driver_tea5767.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup tea5767_simulator_driver tea5767 simulator driver function
+ * @brief    tea5767 simulator driver modules
+ * @ingroup  tea5767_driver
+ * @{
+ */
+
+/**
+ * @brief tea5767 simulator default definition
+ */
+#define TEA5767_SIMULATOR_MAX_STATION             32             /**< max station number */
+#define TEA5767_SIMULATOR_DEFAULT_ADDRESS         0xC0           /**< iic device address */
+#define TEA5767_SIMULATOR_DEFAULT_IIC_HZ          100000         /**< 100KHz iic bus */
+#define TEA5767_SIMULATOR_DEFAULT_TUNE_US         10000          /**< 10ms preset tuning time */
+#define TEA5767_SIMULATOR_DEFAULT_SEARCH_STEP_US  2000           /**< 2ms per 100KHz search step */
+#define TEA5767_SIMULATOR_DEFAULT_NOISE_LEVEL     3              /**< level adc output without station */
+#define TEA5767_SIMULATOR_LEVEL_ROLLOFF_HZ        20000          /**< one level step per 20KHz detuning */
+#define TEA5767_SIMULATOR_IF_NOMINAL              0x37           /**< if counter at 225KHz */
+#define TEA5767_SIMULATOR_IF_STEP_HZ              4000           /**< if counter resolution in Hz */
+
+/**
+ * @brief tea5767 simulator station structure definition
+ */
+typedef struct tea5767_simulator_station_s
+{
+    uint32_t khz;          /**< station frequency in KHz */
+    uint8_t level;         /**< peak level adc output */
+    uint8_t stereo;        /**< stereo pilot flag */
+} tea5767_simulator_station_t;
+
+/**
+ * @brief tea5767 simulator statistics structure definition
+ */
+typedef struct tea5767_simulator_stats_s
+{
+    uint64_t time_us;             /**< virtual time since init */
+    uint64_t bus_us;              /**< virtual iic bus time */
+    uint32_t write_count;         /**< write transfers */
+    uint32_t read_count;          /**< read transfers */
+    uint32_t write_bytes;         /**< written bytes */
+    uint32_t read_bytes;          /**< read bytes */
+    uint32_t tune_count;          /**< preset tunes */
+    uint32_t search_count;        /**< started searches */
+    uint32_t not_ready_count;     /**< reads while the pll was settling */
+} tea5767_simulator_stats_t;
+
+/**
+ * @brief tea5767 simulator structure definition
+ */
+typedef struct tea5767_simulator_s
+{
+    uint8_t addr;                                                            /**< iic device address */
+    uint32_t iic_hz;                                                         /**< iic bus clock */
+    uint32_t tune_us;                                                        /**< preset tuning time */
+    uint32_t search_step_us;                                                 /**< search time per step */
+    uint8_t noise_level;                                                     /**< level without station */
+    tea5767_simulator_station_t station[TEA5767_SIMULATOR_MAX_STATION];      /**< station table */
+    uint8_t station_num;                                                     /**< station number */
+    uint8_t reg[5];                                                          /**< latched write registers */
+    uint16_t pll;                                                            /**< tuned pll */
+    uint8_t blf;                                                             /**< band limit flag */
+    uint64_t ready_us;                                                       /**< pll settled time */
+    uint8_t hold[2];                                                         /**< if and level bytes of the last settled pll */
+    tea5767_simulator_stats_t stats;                                         /**< statistics */
+} tea5767_simulator_t;
+
+/**
+ * @brief     initialize the simulator with the default band
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      none
+ */
+uint8_t tea5767_simulator_init(tea5767_simulator_t *sim);
+
+/**
+ * @brief     remove all stations
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      none
+ */
+uint8_t tea5767_simulator_clear_station(tea5767_simulator_t *sim);
+
+/**
+ * @brief     add a station
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] khz station frequency in KHz
+ * @param[in] level peak level adc output
+ * @param[in] stereo stereo pilot flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 station table is full
+ *            - 2 sim is NULL
+ *            - 4 level > 15
+ * @note      none
+ */
+uint8_t tea5767_simulator_add_station(tea5767_simulator_t *sim, uint32_t khz, uint8_t level, uint8_t stereo);
+
+/**
+ * @brief     set the timing model
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] iic_hz iic bus clock in Hz
+ * @param[in] tune_us preset tuning time in us
+ * @param[in] search_step_us search time per 100KHz step in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 iic_hz is 0
+ * @note      none
+ */
+uint8_t tea5767_simulator_set_timing(tea5767_simulator_t *sim, uint32_t iic_hz, uint32_t tune_us, uint32_t search_step_us);
+
+/**
+ * @brief     simulate an iic write transfer
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 no acknowledge
+ * @note      bytes are latched in order, so a short write keeps the tail registers,
+ *            the if counter and the level adc keep the last settled reading while a new pll settles
+ */
+uint8_t tea5767_simulator_write(tea5767_simulator_t *sim, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulate an iic read transfer
+ * @param[in]  *sim pointer to a tea5767 simulator structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no acknowledge
+ * @note       none
+ */
+uint8_t tea5767_simulator_read(tea5767_simulator_t *sim, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     advance the virtual time
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @param[in] us elapsed time in us
+ * @note      none
+ */
+void tea5767_simulator_advance_us(tea5767_simulator_t *sim, uint32_t us);
+
+/**
+ * @brief     get the virtual time
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    virtual time in us
+ * @note      none
+ */
+uint64_t tea5767_simulator_get_time_us(tea5767_simulator_t *sim);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *sim pointer to a tea5767 simulator structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim is NULL
+ * @note       none
+ */
+uint8_t tea5767_simulator_get_stats(tea5767_simulator_t *sim, tea5767_simulator_stats_t *stats);
+
+/**
+ * @brief     reset the statistics
+ * @param[in] *sim pointer to a tea5767 simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the virtual time keeps running
+ */
+uint8_t tea5767_simulator_reset_stats(tea5767_simulator_t *sim);
+
+/**
+ * @brief  get the default simulator instance
+ * @return pointer to the default simulator
+ * @note   the default instance is initialized on the first call
+ */
+tea5767_simulator_t *tea5767_simulator_get_default(void);
+
+/**
+ * @brief  simulator iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t tea5767_simulator_iic_init(void);
+
+/**
+ * @brief  simulator iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t tea5767_simulator_iic_deinit(void);
+
+/**
+ * @brief     simulator iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      uses the default simulator
+ */
+uint8_t tea5767_simulator_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulator iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       uses the default simulator
+ */
+uint8_t tea5767_simulator_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulator delay ms
+ * @param[in] ms time
+ * @note      advances the virtual time of the default simulator
+ */
+void tea5767_simulator_delay_ms(uint32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_stats_test.c
+ * @brief     driver tea5767 stats test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_stats_test.h"
+
+static tea5767_handle_t gs_handle;        /**< tea5767 handle */
+static tea5767_stats_t gs_stats;          /**< operation stats */
+static uint32_t gs_ms;                    /**< time of the driver delays in ms */
+
+/**
+ * @brief  stats clock
+ * @return time of the driver delays in us
+ * @note   the bus transfers take no time on this clock
+ */
+static uint32_t a_stats_clock_us(void)
+{
+    return gs_ms * 1000;
+}
+
+/**
+ * @brief     stats delay
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_stats_delay_ms(uint32_t ms)
+{
+    tea5767_interface_delay_ms(ms);
+    gs_ms += ms;
+}
+
+/**
+ * @brief  stats test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   one conf write and one search are counted, the snapshot must hold them and reset the counters,
+ *         the test is skipped when TEA5767_STATS is 0
+ */
+uint8_t tea5767_stats_test(void)
+{
+    uint8_t res;
+    uint32_t us;
+    tea5767_search_status_t status;
+    tea5767_stats_t snapshot;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, a_stats_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    DRIVER_TEA5767_LINK_STATS(&gs_handle, &gs_stats);
+    
+    /* start stats test */
+    tea5767_interface_debug_print("tea5767: start stats test.\n");
+    
+#if (TEA5767_STATS == 0)
+    /* the counters need the stats hook */
+    tea5767_interface_debug_print("tea5767: stats hook is compiled out by TEA5767_STATS, skip stats test.\n");
+    
+    return 0;
+#endif
+    
+    /* stats init */
+    gs_ms = 0;
+    res = tea5767_stats_init(&gs_stats, a_stats_clock_us);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: stats init failed.\n");
+        
+        return 1;
+    }
+    
+    /* tea5767 init */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* write the conf */
+    (void)tea5767_set_mute(&gs_handle, TEA5767_BOOL_FALSE);
+    (void)tea5767_set_band(&gs_handle, TEA5767_BAND_US_EUROPE);
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_search_stop_level(&gs_handle, TEA5767_SEARCH_STOP_LEVEL_MID);
+    (void)tea5767_set_pll(&gs_handle, 0x2A00);
+    res = tea5767_write_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: write conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* search up */
+    res = tea5767_search_start(&gs_handle, TEA5767_SEARCH_MODE_UP, gs_ms);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: search start failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    status = TEA5767_SEARCH_STATUS_BUSY;
+    while (status == TEA5767_SEARCH_STATUS_BUSY)
+    {
+        res = tea5767_search_poll(&gs_handle, gs_ms, &status);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: search poll failed.\n");
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        a_stats_delay_ms(1);
+    }
+    
+    /* take the snapshot and reset */
+    (void)tea5767_stats_snapshot(&gs_stats, &snapshot, 1);
+    tea5767_interface_debug_print("tea5767: %d iic reads, %d iic writes, %d iic write reads, %d write confs, %d searches.\n", 
+                                  snapshot.counter[TEA5767_STATS_OP_IIC_READ].count, snapshot.counter[TEA5767_STATS_OP_IIC_WRITE].count, 
+                                  snapshot.counter[TEA5767_STATS_OP_IIC_WRITE_READ].count, snapshot.counter[TEA5767_STATS_OP_WRITE_CONF].count, 
+                                  snapshot.counter[TEA5767_STATS_OP_SEARCH].count);
+    if ((snapshot.counter[TEA5767_STATS_OP_WRITE_CONF].count != 1) || (snapshot.counter[TEA5767_STATS_OP_SEARCH].count != 1) || 
+        (snapshot.counter[TEA5767_STATS_OP_IIC_READ].count == 0) || (gs_stats.counter[TEA5767_STATS_OP_IIC_READ].count != 0))
+    {
+        tea5767_interface_debug_print("tea5767: stats are wrong.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the search latency */
+    res = tea5767_stats_percentile(&snapshot.counter[TEA5767_STATS_OP_SEARCH], 500, &us);
+    if ((res != 0) || (snapshot.counter[TEA5767_STATS_OP_SEARCH].min_us == 0) || 
+        (us < snapshot.counter[TEA5767_STATS_OP_SEARCH].min_us) || (us > snapshot.counter[TEA5767_STATS_OP_SEARCH].max_us))
+    {
+        tea5767_interface_debug_print("tea5767: search latency is wrong.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    tea5767_interface_debug_print("tea5767: search latency min %dms p50 %dms max %dms.\n", 
+                                  snapshot.counter[TEA5767_STATS_OP_SEARCH].min_us / 1000, us / 1000, 
+                                  snapshot.counter[TEA5767_STATS_OP_SEARCH].max_us / 1000);
+    
+    /* finish stats test */
+    tea5767_interface_debug_print("tea5767: finish stats test.\n");
+    (void)tea5767_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_telemetry_test.c
+ * @brief     driver tea5767 telemetry test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_telemetry_test.h"
+
+static tea5767_handle_t gs_handle;                          /**< tea5767 handle */
+static tea5767_telemetry_t gs_telemetry;                    /**< telemetry */
+static tea5767_telemetry_ring_t gs_telemetry_ring;          /**< telemetry ring */
+
+/**
+ * @brief  telemetry test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a tuned station is sampled every 100ms for 1s and the samples are checked against one status read
+ */
+uint8_t tea5767_telemetry_test(void)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t num;
+    uint16_t pll;
+    tea5767_status_t status;
+    tea5767_telemetry_reader_t reader;
+    tea5767_telemetry_sample_t sample;
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    
+    /* start telemetry test */
+    tea5767_interface_debug_print("tea5767: start telemetry test.\n");
+    
+    /* tea5767 init */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* tune 88.7MHz */
+    (void)tea5767_set_mute(&gs_handle, TEA5767_BOOL_FALSE);
+    (void)tea5767_set_band(&gs_handle, TEA5767_BAND_US_EUROPE);
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_side_injection(&gs_handle, TEA5767_SIDE_INJECTION_LOW);
+    res = tea5767_khz_to_pll(&gs_handle, 88700, &pll);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: khz to pll failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)tea5767_set_pll(&gs_handle, pll);
+    res = tea5767_write_conf(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: write conf failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    tea5767_interface_delay_ms(100);
+    
+    /* telemetry init */
+    res = tea5767_telemetry_init(&gs_telemetry, &gs_handle, &gs_telemetry_ring);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: telemetry init failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* sample every 100ms for 1s */
+    tea5767_interface_debug_print("tea5767: sample every 100ms.\n");
+    (void)tea5767_telemetry_subscribe(&gs_telemetry_ring, &reader);
+    (void)tea5767_telemetry_set_period(&gs_telemetry, 100, 0);
+    for (i = 0; i < 1000; i++)
+    {
+        res = tea5767_telemetry_poll(&gs_telemetry, i);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: telemetry poll failed.\n");
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        tea5767_interface_delay_ms(1);
+    }
+    
+    /* read the status once */
+    res = tea5767_read_status_snapshot(&gs_handle, &status);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: read status snapshot failed.\n");
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the samples */
+    num = 0;
+    while (tea5767_telemetry_read(&gs_telemetry_ring, &reader, &sample) == 0)
+    {
+        tea5767_interface_debug_print("tea5767: %dms %dKHz level 0x%02X if 0x%02X %s.\n", 
+                                      sample.timestamp_ms, sample.khz, sample.level, sample.if_out, 
+                                      (sample.reception == TEA5767_RECEPTION_MONO) ? "mono" : "stereo");
+        if ((sample.timestamp_ms != (uint32_t)num * 100) || (sample.khz != status.khz))
+        {
+            tea5767_interface_debug_print("tea5767: sample %d is wrong.\n", num);
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        num++;
+    }
+    if (num != 10)
+    {
+        tea5767_interface_debug_print("tea5767: telemetry got %d samples.\n", num);
+        (void)tea5767_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish telemetry test */
+    tea5767_interface_debug_print("tea5767: finish telemetry test.\n");
+    (void)tea5767_deinit(&gs_handle);
+    
+    return 0;
+}
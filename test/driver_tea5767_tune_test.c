@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_tea5767_tune_test.c
+ * @brief     driver tea5767 tune test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_tea5767_tune_test.h"
+
+static tea5767_handle_t gs_handle;        /**< tea5767 handle */
+static tea5767_task_t gs_task;            /**< tune optimal task */
+
+/**
+ * @brief  tune test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   82.05MHz and 82.5MHz are each on the image of the other one and an image raises the level,
+ *         so 82.05MHz must be tuned with the low side and 82.5MHz with the high side
+ */
+uint8_t tea5767_tune_test(void)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t level;
+    uint32_t ms;
+    tea5767_task_status_t status;
+    tea5767_side_injection_t side;
+    tea5767_side_injection_t conf_side;
+    const uint32_t khz[2] = {82050, 82500};
+    const tea5767_side_injection_t expect[2] = {TEA5767_SIDE_INJECTION_LOW, TEA5767_SIDE_INJECTION_HIGH};
+    
+    /* link functions */
+    DRIVER_TEA5767_LINK_INIT(&gs_handle, tea5767_handle_t);
+    DRIVER_TEA5767_LINK_IIC_INIT(&gs_handle, tea5767_interface_iic_init);
+    DRIVER_TEA5767_LINK_IIC_DEINIT(&gs_handle, tea5767_interface_iic_deinit);
+    DRIVER_TEA5767_LINK_IIC_READ_COMMAND(&gs_handle, tea5767_interface_iic_read_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_COMMAND(&gs_handle, tea5767_interface_iic_write_cmd);
+    DRIVER_TEA5767_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, tea5767_interface_iic_write_read_cmd);
+    DRIVER_TEA5767_LINK_DELAY_MS(&gs_handle, tea5767_interface_delay_ms);
+    DRIVER_TEA5767_LINK_DEBUG_PRINT(&gs_handle, tea5767_interface_debug_print);
+    
+    /* start tune test */
+    tea5767_interface_debug_print("tea5767: start tune test.\n");
+    
+    /* tea5767 init */
+    res = tea5767_init(&gs_handle);
+    if (res != 0)
+    {
+        tea5767_interface_debug_print("tea5767: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* japanese band */
+    (void)tea5767_set_mute(&gs_handle, TEA5767_BOOL_FALSE);
+    (void)tea5767_set_mode(&gs_handle, TEA5767_MODE_NORMAL);
+    (void)tea5767_set_band(&gs_handle, TEA5767_BAND_JAPANESE);
+    (void)tea5767_set_clock(&gs_handle, TEA5767_CLOCK_32P768_KHZ);
+    (void)tea5767_set_side_injection(&gs_handle, TEA5767_SIDE_INJECTION_LOW);
+    
+    /* choose the side injection */
+    for (i = 0; i < 2; i++)
+    {
+        res = tea5767_tune_optimal(&gs_handle, khz[i], &side, &level);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: tune optimal failed.\n");
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        tea5767_interface_debug_print("tea5767: %dKHz %s side injection level 0x%02X.\n", 
+                                      khz[i], (side == TEA5767_SIDE_INJECTION_LOW) ? "low" : "high", level);
+        
+        /* check the chosen side */
+        res = tea5767_get_side_injection(&gs_handle, &conf_side);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: get side injection failed.\n");
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if ((side != expect[i]) || (conf_side != side))
+        {
+            tea5767_interface_debug_print("tea5767: %dKHz chose the wrong side.\n", khz[i]);
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* run the task to get the image levels */
+        res = tea5767_tune_optimal_task(&gs_handle, &gs_task, khz[i]);
+        if (res != 0)
+        {
+            tea5767_interface_debug_print("tea5767: tune optimal task failed.\n");
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ms = 0;
+        status = TEA5767_TASK_STATUS_BUSY;
+        while (status == TEA5767_TASK_STATUS_BUSY)
+        {
+            (void)tea5767_task_step(&gs_task, ms, &status);
+            tea5767_interface_delay_ms(1);
+            ms++;
+        }
+        
+        /* output */
+        tea5767_interface_debug_print("tea5767: %dKHz low side image level 0x%02X, high side image level 0x%02X.\n", 
+                                      khz[i], gs_task.level[TEA5767_SIDE_INJECTION_LOW], gs_task.level[TEA5767_SIDE_INJECTION_HIGH]);
+        
+        /* the other side must see the station on its image */
+        if ((status != TEA5767_TASK_STATUS_DONE) || (gs_task.side != side) || 
+            (gs_task.level[side] >= gs_task.level[side ^ 1]) || (gs_task.level[2] != level))
+        {
+            tea5767_interface_debug_print("tea5767: %dKHz image levels are wrong.\n", khz[i]);
+            (void)tea5767_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* finish tune test */
+    tea5767_interface_debug_print("tea5767: finish tune test.\n");
+    (void)tea5767_deinit(&gs_handle);
+    
+    return 0;
+}